@@ -0,0 +1,56 @@
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <memory>
+
+#include "expu/allocators/arena_allocator.hpp"
+#include "expu/containers/darray.hpp"
+
+//Simulates a request building several temporary arrays of 2^n elements in total, then discarding all of them.
+static constexpr size_t _arrays_per_request = 16;
+
+template<class Array>
+static void _serve_request(Array* const arrays, const typename Array::allocator_type& alloc, const size_t elements)
+{
+    for (size_t i = 0; i < _arrays_per_request; ++i) {
+        Array& arr = *std::construct_at(arrays + i, alloc);
+
+        for (size_t j = 0; j < elements / _arrays_per_request; ++j)
+            arr.push_back(static_cast<uint64_t>(i ^ j));
+
+        benchmark::DoNotOptimize(arr.begin());
+    }
+
+    std::destroy_n(arrays, _arrays_per_request);
+}
+
+static void BM_request_churn_std_allocator(benchmark::State& state) {
+    using array_type = expu::darray<uint64_t>;
+
+    const size_t elements = size_t(1) << state.range(0);
+    alignas(array_type) std::byte storage[_arrays_per_request * sizeof(array_type)];
+
+    for (auto _ : state)
+        _serve_request(reinterpret_cast<array_type*>(storage), array_type::allocator_type(), elements);
+
+    state.SetItemsProcessed(state.iterations() * elements);
+}
+
+static void BM_request_churn_arena_allocator(benchmark::State& state) {
+    using array_type = expu::darray<uint64_t, expu::arena_allocator<uint64_t>>;
+
+    const size_t elements = size_t(1) << state.range(0);
+    alignas(array_type) std::byte storage[_arrays_per_request * sizeof(array_type)];
+
+    expu::arena arena;
+
+    for (auto _ : state) {
+        _serve_request(reinterpret_cast<array_type*>(storage), array_type::allocator_type(arena), elements);
+        arena.reset();
+    }
+
+    state.SetItemsProcessed(state.iterations() * elements);
+}
+
+BENCHMARK(BM_request_churn_std_allocator)->DenseRange(8, 20, 4);
+BENCHMARK(BM_request_churn_arena_allocator)->DenseRange(8, 20, 4);
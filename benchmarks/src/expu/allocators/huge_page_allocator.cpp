@@ -0,0 +1,31 @@
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <memory>
+
+#include "expu/allocators/huge_page_allocator.hpp"
+#include "expu/containers/fixed_array.hpp"
+
+//Random lookups in to a table of 2^n bytes, which far exceeds the reach of the TLB when backed by 4KiB pages.
+template<class Alloc>
+static void BM_random_lookup(benchmark::State& state) {
+    const size_t count = (size_t(1) << state.range(0)) / sizeof(uint64_t);
+
+    const expu::fixed_array<uint64_t, Alloc> table(count, 1);
+
+    uint64_t index = 0, sum = 0;
+
+    for (auto _ : state) {
+        //Note: Each lookup depends on the last, so that misses are not overlapped
+        for (size_t i = 0; i < 1024; ++i) {
+            index = (index * 6364136223846793005ull + 1442695040888963407ull + sum) % count;
+            sum  += table[index];
+        }
+    }
+
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * 1024);
+}
+
+BENCHMARK(BM_random_lookup<std::allocator<uint64_t>>)->DenseRange(24, 30, 3);
+BENCHMARK(BM_random_lookup<expu::huge_page_allocator<uint64_t>>)->DenseRange(24, 30, 3);
@@ -0,0 +1,58 @@
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "expu/allocators/pool_allocator.hpp"
+#include "expu/containers/darray.hpp"
+
+//Simulates a long lived population of 2^n small arrays, of which a random one is rebuilt each iteration.
+static constexpr size_t _max_small_array_size = 12;
+
+template<class Array>
+static void _churn_small_arrays(benchmark::State& state, const typename Array::allocator_type& alloc)
+{
+    const size_t count = size_t(1) << state.range(0);
+
+    std::mt19937_64 gen(42);
+
+    std::vector<Array> arrays;
+    arrays.reserve(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        Array& arr = arrays.emplace_back(alloc);
+
+        for (size_t j = 0, size = gen() % _max_small_array_size; j < size; ++j)
+            arr.push_back(static_cast<uint32_t>(j));
+    }
+
+    for (auto _ : state) {
+        Array& arr = arrays[gen() % count];
+        arr = Array(alloc);
+
+        for (size_t j = 0, size = gen() % _max_small_array_size; j < size; ++j)
+            arr.push_back(static_cast<uint32_t>(j));
+
+        benchmark::DoNotOptimize(arr.begin());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_small_array_churn_std_allocator(benchmark::State& state) {
+    using array_type = expu::darray<uint32_t>;
+
+    _churn_small_arrays<array_type>(state, array_type::allocator_type());
+}
+
+static void BM_small_array_churn_pool_allocator(benchmark::State& state) {
+    using array_type = expu::darray<uint32_t, expu::pool_allocator<uint32_t>>;
+
+    expu::pool pool;
+    _churn_small_arrays<array_type>(state, array_type::allocator_type(pool));
+}
+
+BENCHMARK(BM_small_array_churn_std_allocator)->DenseRange(10, 20, 5);
+BENCHMARK(BM_small_array_churn_pool_allocator)->DenseRange(10, 20, 5);
@@ -0,0 +1,43 @@
+#include "benchmark/benchmark.h"
+
+#include <vector>
+
+#include "expu/containers/bit_darray.hpp"
+
+template<class Container>
+static void BM_bit_push_back(benchmark::State& state) {
+    const size_t push_back_count = 1 << state.range(0);
+
+    for (auto _ : state) {
+        Container arr;
+
+        for (size_t i = 0; i < push_back_count; ++i)
+            arr.push_back((i * 7) % 5 == 0);
+
+        benchmark::DoNotOptimize(arr.begin());
+    }
+
+    state.SetItemsProcessed(state.iterations() * push_back_count);
+    state.SetLabel(std::to_string(push_back_count >> 10));
+}
+
+static void BM_bit_append_bits(benchmark::State& state) {
+    const size_t bit_count = 1 << state.range(0);
+
+    for (auto _ : state) {
+        expu::bit_darray<> arr;
+
+        //Note: Odd chunk size keeps appends unaligned
+        for (size_t i = 0; i < bit_count; i += 61)
+            arr.append_bits(i * 0x9E3779B97F4A7C15, 61);
+
+        benchmark::DoNotOptimize(arr.begin());
+    }
+
+    state.SetItemsProcessed(state.iterations() * bit_count);
+    state.SetLabel(std::to_string(bit_count >> 10));
+}
+
+BENCHMARK(BM_bit_push_back<std::vector<bool>>)->DenseRange(10, 22, 4);
+BENCHMARK(BM_bit_push_back<expu::bit_darray<>>)->DenseRange(10, 22, 4);
+BENCHMARK(BM_bit_append_bits)->DenseRange(10, 22, 4);
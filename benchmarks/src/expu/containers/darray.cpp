@@ -1,9 +1,15 @@
 #include "benchmark/benchmark.h"
 
+#include <algorithm>
+#include <cstring>
+#include <span>
 #include <vector>
 
 #include "expu/containers/darray.hpp"
 
+#include "expu/iterators/seq_iter.hpp"
+#include "expu/testing/iterator_downcast.hpp"
+
 template<class Container>
 static void BM_push_back(benchmark::State& state) {
     const size_t push_back_count = 1 << state.range(0);
@@ -20,7 +26,235 @@ static void BM_push_back(benchmark::State& state) {
     state.SetLabel(std::to_string(bytes >> 10));
 }
 
+template<class GrowthPolicy>
+static void BM_push_back_growth(benchmark::State& state) {
+    using darray_type = expu::darray<int, std::allocator<int>, GrowthPolicy>;
+
+    const size_t push_back_count = 1 << state.range(0);
+
+    size_t reallocations = 0;
+    size_t slack = 0;
+
+    for (auto _ : state) {
+        darray_type arr;
+
+        reallocations = 0;
+        for (size_t i = 0; i < push_back_count; ++i) {
+            const auto old_capacity = arr.capacity();
+            arr.push_back(static_cast<int>(i));
+            reallocations += (old_capacity != arr.capacity());
+        }
+
+        slack = arr.capacity() - arr.size();
+        benchmark::DoNotOptimize(arr.begin());
+    }
+
+    const size_t bytes = push_back_count * sizeof(int);
+    state.SetBytesProcessed(state.iterations() * bytes);
+    state.counters["reallocations"] = static_cast<double>(reallocations);
+    state.counters["slack_bytes"]   = static_cast<double>(slack * sizeof(int));
+}
+
+//Drops roughly 3% of rows, as a filter stage would. Each iteration copies the source, hence compare against BM_filter_copy.
+static bool _is_filtered(const uint64_t row) noexcept
+{
+    return (row * 0x9E3779B97F4A7C15 >> 59) == 0;
+}
+
+static void BM_filter_copy(benchmark::State& state) {
+    const expu::darray<uint64_t> source(expu::seq_iter<uint64_t>(0), expu::seq_iter<uint64_t>(uint64_t(1) << state.range(0)));
+
+    for (auto _ : state) {
+        expu::darray<uint64_t> arr(source);
+        benchmark::DoNotOptimize(arr.begin());
+    }
+
+    state.SetItemsProcessed(state.iterations() * source.size());
+}
+
+static void BM_filter_rebuild(benchmark::State& state) {
+    const expu::darray<uint64_t> source(expu::seq_iter<uint64_t>(0), expu::seq_iter<uint64_t>(uint64_t(1) << state.range(0)));
+
+    for (auto _ : state) {
+        expu::darray<uint64_t> arr(source);
+
+        expu::darray<uint64_t> kept;
+        kept.reserve(arr.size());
+        for (const uint64_t row : arr)
+            if (!_is_filtered(row))
+                kept.push_back(row);
+
+        arr = std::move(kept);
+        benchmark::DoNotOptimize(arr.begin());
+    }
+
+    state.SetItemsProcessed(state.iterations() * source.size());
+}
+
+template<class Container>
+static void BM_filter_erase_if(benchmark::State& state) {
+    const expu::darray<uint64_t> source(expu::seq_iter<uint64_t>(0), expu::seq_iter<uint64_t>(uint64_t(1) << state.range(0)));
+
+    for (auto _ : state) {
+        Container arr(source.begin(), source.end());
+
+        erase_if(arr, _is_filtered); //Note: Found by ADL, std::erase_if or expu::erase_if
+        benchmark::DoNotOptimize(arr.begin());
+    }
+
+    state.SetItemsProcessed(state.iterations() * source.size());
+}
+
+//Inserts an input only range of 2^n elements into the middle of as many elements.
+//BM_insert_input_rotate does so as darray previously did, appending then rotating into place.
+using _input_iter = expu::iterator_downcast<expu::seq_iter<uint64_t>, std::input_iterator_tag>;
+
+template<class Container>
+static void BM_insert_input(benchmark::State& state) {
+    const uint64_t count = uint64_t(1) << state.range(0);
+    const expu::darray<uint64_t> source(expu::seq_iter<uint64_t>(0), expu::seq_iter<uint64_t>(count));
+
+    for (auto _ : state) {
+        Container arr(source.begin(), source.end());
+
+        arr.insert(arr.begin() + count / 2, _input_iter(expu::seq_iter<uint64_t>(0)), _input_iter(expu::seq_iter<uint64_t>(count)));
+        benchmark::DoNotOptimize(arr.begin());
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+static void BM_insert_input_rotate(benchmark::State& state) {
+    const uint64_t count = uint64_t(1) << state.range(0);
+    const expu::darray<uint64_t> source(expu::seq_iter<uint64_t>(0), expu::seq_iter<uint64_t>(count));
+
+    for (auto _ : state) {
+        expu::darray<uint64_t> arr(source.begin(), source.end());
+
+        for (_input_iter first{ expu::seq_iter<uint64_t>(0) }, last{ expu::seq_iter<uint64_t>(count) }; first != last; ++first)
+            arr.emplace_back(*first);
+
+        std::rotate(arr.begin() + count / 2, arr.begin() + count, arr.end());
+        benchmark::DoNotOptimize(arr.begin());
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+//Delta decodes 2^n values, whose count is known upfront, appending them either one at a time or via spare_capacity.
+static expu::darray<uint32_t> _make_deltas(const size_t count)
+{
+    expu::darray<uint32_t> deltas;
+    for (size_t i = 0; i < count; ++i)
+        deltas.push_back(static_cast<uint32_t>(i * 0x9E3779B9u) >> 24);
+
+    return deltas;
+}
+
+static void BM_decode_push_back(benchmark::State& state) {
+    const auto deltas = _make_deltas(size_t(1) << state.range(0));
+
+    for (auto _ : state) {
+        expu::darray<uint32_t> values;
+        values.reserve(deltas.size());
+
+        uint32_t value = 0;
+        for (const uint32_t delta : deltas)
+            values.push_back(value += delta);
+
+        benchmark::DoNotOptimize(values.begin());
+    }
+
+    state.SetItemsProcessed(state.iterations() * deltas.size());
+}
+
+static void BM_decode_spare_capacity(benchmark::State& state) {
+    const auto deltas = _make_deltas(size_t(1) << state.range(0));
+
+    for (auto _ : state) {
+        expu::darray<uint32_t> values;
+        values.reserve(deltas.size());
+
+        const std::span<uint32_t> spare = values.spare_capacity();
+
+        uint32_t value = 0;
+        for (size_t i = 0; i < deltas.size(); ++i)
+            spare[i] = value += deltas.begin()[i];
+
+        values.commit(deltas.size());
+        benchmark::DoNotOptimize(values.begin());
+    }
+
+    state.SetItemsProcessed(state.iterations() * deltas.size());
+}
+
+//Snapshots a table of 2^n elements, by copy construction
+template<class GrowthPolicy>
+static void BM_copy_construct_growth(benchmark::State& state) {
+    using array_type = expu::darray<uint64_t, std::allocator<uint64_t>, GrowthPolicy>;
+
+    const array_type table{ expu::seq_iter<uint64_t>(0), expu::seq_iter<uint64_t>(uint64_t(1) << state.range(0)) };
+
+    for (auto _ : state) {
+        const array_type snapshot(table);
+        benchmark::DoNotOptimize(snapshot.begin());
+    }
+
+    state.SetBytesProcessed(state.iterations() * table.size() * sizeof(uint64_t));
+}
+
+//Relocates 2^n bytes, as on reallocation, then sums a 1MiB hot set which the copy should not have evicted
+template<bool Stream>
+static void BM_relocate_then_scan_hot_set(benchmark::State& state) {
+    const size_t size = size_t(1) << state.range(0);
+
+    const std::vector<uint64_t> hot_set(size_t(1) << 17, 1);
+    const std::vector<char>     source(size, 1);
+    std::vector<char>           dest(size);
+
+    uint64_t sum = 0;
+
+    for (auto _ : state) {
+        if constexpr (Stream)
+            expu::_stream_memcpy(dest.data(), source.data(), size);
+        else
+            std::memcpy(dest.data(), source.data(), size);
+
+        for (const uint64_t value : hot_set)
+            sum += value;
+
+        benchmark::DoNotOptimize(sum);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * size);
+}
+
 //BENCHMARK(BM_push_back<std::vector<int>>)->DenseRange(8, 23);
 BENCHMARK(BM_push_back<expu::darray<int>>)->DenseRange(8, 23);
 
+BENCHMARK(BM_push_back_growth<expu::geometric_growth<3, 2>>)->DenseRange(8, 23, 3);
+BENCHMARK(BM_push_back_growth<expu::geometric_growth<2, 1>>)->DenseRange(8, 23, 3);
+BENCHMARK(BM_push_back_growth<expu::page_rounded_growth<>>)->DenseRange(8, 23, 3);
+BENCHMARK(BM_push_back_growth<expu::jemalloc_size_class_growth<>>)->DenseRange(8, 23, 3);
+BENCHMARK(BM_push_back_growth<expu::exact_growth>)->DenseRange(8, 14, 3);
+
+BENCHMARK(BM_copy_construct_growth<expu::default_growth>)->DenseRange(18, 26, 4)->UseRealTime();
+BENCHMARK(BM_copy_construct_growth<expu::parallel_copy_growth<>>)->DenseRange(18, 26, 4)->UseRealTime();
+
+BENCHMARK(BM_relocate_then_scan_hot_set<false>)->DenseRange(21, 27, 3);
+BENCHMARK(BM_relocate_then_scan_hot_set<true>)->DenseRange(21, 27, 3);
+
+BENCHMARK(BM_decode_push_back)->DenseRange(8, 20, 4);
+BENCHMARK(BM_decode_spare_capacity)->DenseRange(8, 20, 4);
+
+BENCHMARK(BM_insert_input_rotate)->DenseRange(6, 18, 4);
+BENCHMARK(BM_insert_input<std::vector<uint64_t>>)->DenseRange(6, 18, 4);
+BENCHMARK(BM_insert_input<expu::darray<uint64_t>>)->DenseRange(6, 18, 4);
+
+BENCHMARK(BM_filter_copy)->DenseRange(10, 22, 4);
+BENCHMARK(BM_filter_rebuild)->DenseRange(10, 22, 4);
+BENCHMARK(BM_filter_erase_if<std::vector<uint64_t>>)->DenseRange(10, 22, 4);
+BENCHMARK(BM_filter_erase_if<expu::darray<uint64_t>>)->DenseRange(10, 22, 4);
+
 BENCHMARK_MAIN();
@@ -0,0 +1,65 @@
+#include "benchmark/benchmark.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "expu/containers/fixed_array.hpp"
+
+template<class Container>
+static void BM_fill_construct(benchmark::State& state) {
+    using value_type = typename Container::value_type;
+
+    const size_t count = 1 << state.range(0);
+
+    for (auto _ : state) {
+        Container arr(count, value_type(1.5));
+        benchmark::DoNotOptimize(arr.begin());
+    }
+
+    const size_t bytes = count * sizeof(value_type);
+    state.SetBytesProcessed(state.iterations() * bytes);
+    state.SetLabel(std::to_string(bytes >> 10));
+}
+
+BENCHMARK(BM_fill_construct<std::vector<float>>)->DenseRange(10, 26, 4);
+BENCHMARK(BM_fill_construct<expu::fixed_array<float>>)->DenseRange(10, 26, 4);
+BENCHMARK(BM_fill_construct<expu::fixed_array<double>>)->DenseRange(10, 26, 4);
+
+static void BM_bool_pack_construct(benchmark::State& state) {
+    const size_t count = 1 << state.range(0);
+
+    std::vector<uint8_t> flags(count);
+    for (size_t i = 0; i < count; ++i)
+        flags[i] = static_cast<uint8_t>((i * 7 + i / 3) % 5 == 0);
+
+    for (auto _ : state) {
+        expu::fixed_array<bool> arr(flags.begin(), flags.end());
+        benchmark::DoNotOptimize(arr.begin());
+    }
+
+    state.SetBytesProcessed(state.iterations() * count);
+    state.SetLabel(std::to_string(count >> 10));
+}
+
+BENCHMARK(BM_bool_pack_construct)->DenseRange(10, 26, 4);
+
+template<bool UseWordAlgorithms>
+static void BM_bool_count(benchmark::State& state) {
+    const size_t count = 1 << state.range(0);
+
+    expu::fixed_array<bool> arr(count, false);
+    arr[count - 1] = true;
+
+    for (auto _ : state) {
+        if constexpr (UseWordAlgorithms)
+            benchmark::DoNotOptimize(expu::count(arr.cbegin(), arr.cend(), true));
+        else
+            benchmark::DoNotOptimize(std::count(arr.cbegin(), arr.cend(), true));
+    }
+
+    state.SetBytesProcessed(state.iterations() * (count >> 3));
+    state.SetLabel(std::to_string(count >> 10));
+}
+
+BENCHMARK(BM_bool_count<false>)->DenseRange(10, 26, 8);
+BENCHMARK(BM_bool_count<true>)->DenseRange(10, 26, 8);
@@ -0,0 +1,86 @@
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "expu/containers/flat_hash_map.hpp"
+#include "expu/containers/linear_map.hpp"
+
+static std::vector<uint64_t> _make_keys(size_t count, uint64_t seed) {
+    std::vector<uint64_t> keys(count);
+
+    for (auto& key : keys) {
+        seed = seed * 6364136223846793005 + 1442695040888963407;
+        key = seed >> 16;
+    }
+
+    return keys;
+}
+
+template<class Map>
+static void BM_map_insert(benchmark::State& state) {
+    const size_t key_count = state.range(0);
+    const auto keys = _make_keys(key_count, 1);
+
+    for (auto _ : state) {
+        Map map;
+
+        for (const auto key : keys)
+            map[key] = key;
+
+        benchmark::DoNotOptimize(map.begin());
+    }
+
+    state.SetItemsProcessed(state.iterations() * key_count);
+}
+
+template<class Map>
+static void BM_map_find_hit(benchmark::State& state) {
+    const size_t key_count = state.range(0);
+    const auto keys = _make_keys(key_count, 1);
+
+    Map map;
+    for (const auto key : keys)
+        map[key] = key;
+
+    for (auto _ : state)
+        for (const auto key : keys)
+            benchmark::DoNotOptimize(map.find(key));
+
+    state.SetItemsProcessed(state.iterations() * key_count);
+}
+
+template<class Map>
+static void BM_map_find_miss(benchmark::State& state) {
+    const size_t key_count = state.range(0);
+    const auto keys   = _make_keys(key_count, 1);
+    const auto misses = _make_keys(key_count, 2);
+
+    Map map;
+    for (const auto key : keys)
+        map[key] = key;
+
+    for (auto _ : state)
+        for (const auto key : misses)
+            benchmark::DoNotOptimize(map.find(key));
+
+    state.SetItemsProcessed(state.iterations() * key_count);
+}
+
+using _flat_map      = expu::flat_hash_map<uint64_t, uint64_t>;
+using _unordered_map = std::unordered_map<uint64_t, uint64_t>;
+using _linear_map    = expu::linear_map<uint64_t, uint64_t>;
+
+//Note: linear_map lookups are linear, so it is only measured at small sizes
+BENCHMARK(BM_map_insert<_flat_map>)->RangeMultiplier(16)->Range(8, 10'000'000);
+BENCHMARK(BM_map_insert<_unordered_map>)->RangeMultiplier(16)->Range(8, 10'000'000);
+BENCHMARK(BM_map_insert<_linear_map>)->RangeMultiplier(8)->Range(8, 4096);
+
+BENCHMARK(BM_map_find_hit<_flat_map>)->RangeMultiplier(16)->Range(8, 10'000'000);
+BENCHMARK(BM_map_find_hit<_unordered_map>)->RangeMultiplier(16)->Range(8, 10'000'000);
+BENCHMARK(BM_map_find_hit<_linear_map>)->RangeMultiplier(8)->Range(8, 4096);
+
+BENCHMARK(BM_map_find_miss<_flat_map>)->RangeMultiplier(16)->Range(8, 10'000'000);
+BENCHMARK(BM_map_find_miss<_unordered_map>)->RangeMultiplier(16)->Range(8, 10'000'000);
+BENCHMARK(BM_map_find_miss<_linear_map>)->RangeMultiplier(8)->Range(8, 4096);
@@ -0,0 +1,92 @@
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "expu/containers/linear_map.hpp"
+#include "expu/containers/split_darray.hpp"
+
+template<class Map>
+static void BM_linear_map_find(benchmark::State& state) {
+    const size_t key_count = state.range(0);
+
+    Map map;
+    for (size_t i = 0; i < key_count; ++i)
+        map[static_cast<typename Map::key_type>(i * 31 + 7)] = i;
+
+    //Note: Looks up every key once and one absent key, so hits are spread evenly across the map
+    for (auto _ : state) {
+        for (size_t i = 0; i <= key_count; ++i)
+            benchmark::DoNotOptimize(map.find(static_cast<typename Map::key_type>(i * 31 + 7)));
+    }
+
+    state.SetItemsProcessed(state.iterations() * (key_count + 1));
+}
+
+//Note: Keys are longer than the small string buffer, so each temporary std::string allocates
+template<class KeyEqual>
+static void BM_linear_map_find_string_view(benchmark::State& state) {
+    const size_t key_count = state.range(0);
+
+    std::vector<std::string> keys;
+    for (size_t i = 0; i < key_count; ++i)
+        keys.push_back("x-header-name-" + std::to_string(i * 31 + 7));
+
+    expu::linear_map<std::string, size_t, std::vector<std::pair<std::string, size_t>>, KeyEqual> map;
+    for (size_t i = 0; i < key_count; ++i)
+        map[keys[i]] = i;
+
+    for (auto _ : state) {
+        for (const auto& key : keys) {
+            const std::string_view view = key;
+
+            if constexpr (std::is_same_v<KeyEqual, std::equal_to<>>)
+                benchmark::DoNotOptimize(map.find(view));
+            else
+                benchmark::DoNotOptimize(map.find(std::string(view)));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * key_count);
+}
+
+//Erases and reinserts keys, as when sessions churn
+template<class ErasePolicy>
+static void BM_linear_map_churn(benchmark::State& state) {
+    const size_t key_count = state.range(0);
+
+    expu::linear_map<uint32_t, uint64_t, expu::split_darray<uint32_t, uint64_t>, std::equal_to<uint32_t>, ErasePolicy> map;
+    for (size_t i = 0; i < key_count; ++i)
+        map[static_cast<uint32_t>(i)] = i;
+
+    uint32_t key = 0;
+    for (auto _ : state) {
+        key = (key + 7919) % key_count;
+
+        map.erase(key);
+        map[key] = key;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<class Key>
+using _aos_map = expu::linear_map<Key, uint64_t>;
+
+template<class Key>
+using _soa_map = expu::linear_map<Key, uint64_t, expu::split_darray<Key, uint64_t>>;
+
+BENCHMARK(BM_linear_map_find<_aos_map<uint32_t>>)->RangeMultiplier(4)->Range(4, 256);
+BENCHMARK(BM_linear_map_find<_soa_map<uint32_t>>)->RangeMultiplier(4)->Range(4, 256);
+BENCHMARK(BM_linear_map_find<_aos_map<uint64_t>>)->RangeMultiplier(4)->Range(4, 256);
+BENCHMARK(BM_linear_map_find<_soa_map<uint64_t>>)->RangeMultiplier(4)->Range(4, 256);
+BENCHMARK(BM_linear_map_find<_aos_map<uint16_t>>)->RangeMultiplier(4)->Range(4, 256);
+BENCHMARK(BM_linear_map_find<_soa_map<uint16_t>>)->RangeMultiplier(4)->Range(4, 256);
+
+BENCHMARK(BM_linear_map_find_string_view<std::equal_to<std::string>>)->RangeMultiplier(4)->Range(4, 64);
+BENCHMARK(BM_linear_map_find_string_view<std::equal_to<>>)->RangeMultiplier(4)->Range(4, 64);
+
+BENCHMARK(BM_linear_map_churn<expu::ordered_erase>)->RangeMultiplier(4)->Range(256, 4096);
+BENCHMARK(BM_linear_map_churn<expu::unordered_erase>)->RangeMultiplier(4)->Range(256, 4096);
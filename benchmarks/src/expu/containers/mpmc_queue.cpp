@@ -0,0 +1,92 @@
+#include "benchmark/benchmark.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "expu/containers/darray.hpp"
+#include "expu/containers/mpmc_queue.hpp"
+#include "expu/iterators/seq_iter.hpp"
+
+//Even threads produce and odd threads consume, each moving the same number of elements per iteration.
+static constexpr size_t _queue_capacity = 1024;
+static constexpr size_t _batch_size     = 16;
+
+static bool _is_producer(const benchmark::State& state) noexcept
+{
+    return state.thread_index() % 2 == 0;
+}
+
+//Baseline: a darray used as a ring, guarded by a mutex
+class _locked_queue
+{
+public:
+    _locked_queue() { _elements.resize(_queue_capacity); }
+
+    size_t try_push_n(expu::seq_iter<uint64_t> first, const size_t n)
+    {
+        const std::scoped_lock lock(_mutex);
+
+        const size_t count = std::min(n, _queue_capacity - (_tail - _head));
+        for (size_t i = 0; i < count; ++i, ++first)
+            _elements.begin()[(_tail + i) % _queue_capacity] = *first;
+
+        _tail += count;
+        return count;
+    }
+
+    size_t try_pop_n(uint64_t* const out, const size_t n)
+    {
+        const std::scoped_lock lock(_mutex);
+
+        const size_t count = std::min(n, _tail - _head);
+        for (size_t i = 0; i < count; ++i)
+            out[i] = _elements.begin()[(_head + i) % _queue_capacity];
+
+        _head += count;
+        return count;
+    }
+
+private:
+    std::mutex             _mutex;
+    expu::darray<uint64_t> _elements;
+    size_t                 _head = 0;
+    size_t                 _tail = 0;
+};
+
+template<class Queue>
+static void _transfer(benchmark::State& state, Queue& queue, const size_t batch_size)
+{
+    uint64_t buffer[_batch_size];
+
+    for (auto _ : state) {
+        for (size_t done = 0; done < batch_size;) {
+            const size_t count = _is_producer(state) ?
+                queue.try_push_n(expu::seq_iter<uint64_t>(done), batch_size - done) :
+                queue.try_pop_n(buffer, batch_size - done);
+
+            if (count == 0)
+                std::this_thread::yield();
+
+            done += count;
+        }
+
+        benchmark::DoNotOptimize(buffer);
+    }
+
+    state.SetItemsProcessed(state.iterations() * batch_size);
+}
+
+static void BM_mpmc_transfer_locked_darray(benchmark::State& state) {
+    static _locked_queue queue;
+    _transfer(state, queue, static_cast<size_t>(state.range(0)));
+}
+
+static void BM_mpmc_transfer_mpmc_queue(benchmark::State& state) {
+    static expu::mpmc_queue<uint64_t> queue(_queue_capacity);
+    _transfer(state, queue, static_cast<size_t>(state.range(0)));
+}
+
+BENCHMARK(BM_mpmc_transfer_locked_darray)->Arg(1)->Arg(_batch_size)->ThreadRange(2, 64)->UseRealTime();
+BENCHMARK(BM_mpmc_transfer_mpmc_queue)->Arg(1)->Arg(_batch_size)->ThreadRange(2, 64)->UseRealTime();
@@ -0,0 +1,79 @@
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "expu/containers/linear_map.hpp"
+#include "expu/containers/sorted_linear_map.hpp"
+#include "expu/containers/split_darray.hpp"
+
+static std::vector<std::pair<uint32_t, uint32_t>> _make_values(size_t count) {
+    std::vector<std::pair<uint32_t, uint32_t>> values(count);
+
+    uint32_t state = 7;
+    for (auto& [key, value] : values) {
+        state = state * 1664525 + 1013904223;
+        key   = state;
+        value = state >> 3;
+    }
+
+    return values;
+}
+
+template<class Map>
+static void BM_ordered_find(benchmark::State& state) {
+    const auto values = _make_values(state.range(0));
+
+    Map map;
+    for (const auto& [key, value] : values)
+        map[key] = value;
+
+    for (auto _ : state)
+        for (const auto& [key, value] : values)
+            benchmark::DoNotOptimize(map.find(key));
+
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template<class Map>
+static void BM_ordered_build_indexing(benchmark::State& state) {
+    const auto values = _make_values(state.range(0));
+
+    for (auto _ : state) {
+        Map map;
+        for (const auto& [key, value] : values)
+            map[key] = value;
+
+        benchmark::DoNotOptimize(map.begin());
+    }
+
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template<class Map>
+static void BM_ordered_build_insert_range(benchmark::State& state) {
+    const auto values = _make_values(state.range(0));
+
+    for (auto _ : state) {
+        Map map;
+        map.insert_range(values);
+
+        benchmark::DoNotOptimize(map.begin());
+    }
+
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+using _sorted_map       = expu::sorted_linear_map<uint32_t, uint32_t>;
+using _sorted_split_map = expu::sorted_linear_map<uint32_t, uint32_t, expu::split_darray<uint32_t, uint32_t>>;
+using _std_map          = std::map<uint32_t, uint32_t>;
+using _linear_map       = expu::linear_map<uint32_t, uint32_t>;
+
+BENCHMARK(BM_ordered_find<_sorted_map>)->RangeMultiplier(8)->Range(16, 1 << 16);
+BENCHMARK(BM_ordered_find<_sorted_split_map>)->RangeMultiplier(8)->Range(16, 1 << 16);
+BENCHMARK(BM_ordered_find<_std_map>)->RangeMultiplier(8)->Range(16, 1 << 16);
+BENCHMARK(BM_ordered_find<_linear_map>)->RangeMultiplier(8)->Range(16, 1 << 10);
+
+BENCHMARK(BM_ordered_build_indexing<_sorted_map>)->RangeMultiplier(8)->Range(16, 1 << 13);
+BENCHMARK(BM_ordered_build_insert_range<_sorted_map>)->RangeMultiplier(8)->Range(16, 1 << 16);
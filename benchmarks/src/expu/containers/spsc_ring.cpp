@@ -0,0 +1,117 @@
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <utility>
+
+#include "expu/containers/darray.hpp"
+#include "expu/containers/spsc_ring.hpp"
+
+//Thread 0 decodes 2^n bytes per iteration which thread 1 then parses, as between a network reader and a parser.
+static constexpr size_t _ring_capacity = size_t(1) << 16;
+
+static void _decode(const std::span<uint8_t> bytes, const size_t offset) noexcept
+{
+    for (size_t i = 0; i < bytes.size(); ++i)
+        bytes[i] = static_cast<uint8_t>(offset + i);
+}
+
+static uint64_t _parse(const std::span<const uint8_t> bytes) noexcept
+{
+    uint64_t sum = 0;
+    for (const uint8_t byte : bytes)
+        sum += byte;
+
+    return sum;
+}
+
+//Baseline: the producer appends to a shared darray, which the consumer swaps out for an empty one
+static void BM_handoff_locked_darray_swap(benchmark::State& state) {
+    static std::mutex            mutex;
+    static expu::darray<uint8_t> shared;
+
+    const size_t batch_size = size_t(1) << state.range(0);
+
+    expu::darray<uint8_t> local;
+    uint64_t checksum     = 0;
+    size_t   parsed_ahead = 0;
+
+    for (auto _ : state) {
+        if (state.thread_index() == 0) {
+            local.resize(batch_size);
+            _decode({ std::to_address(local.begin()), batch_size }, 0);
+
+            for (;;) {
+                {
+                    const std::scoped_lock lock(mutex);
+
+                    if (shared.size() + batch_size <= _ring_capacity) {
+                        shared.append_range(local);
+                        break;
+                    }
+                }
+
+                std::this_thread::yield();
+            }
+        }
+        else {
+            //Note: Bytes parsed beyond this batch count towards the next
+            while (parsed_ahead < batch_size) {
+                {
+                    const std::scoped_lock lock(mutex);
+                    std::swap(local, shared);
+                }
+
+                checksum     += _parse({ std::to_address(local.begin()), local.size() });
+                parsed_ahead += local.size();
+                local.erase(local.cbegin(), local.cend());
+
+                if (parsed_ahead < batch_size)
+                    std::this_thread::yield();
+            }
+
+            parsed_ahead -= batch_size;
+        }
+    }
+
+    benchmark::DoNotOptimize(checksum);
+    state.SetBytesProcessed(state.iterations() * batch_size);
+}
+
+static void BM_handoff_spsc_ring(benchmark::State& state) {
+    static expu::spsc_ring<uint8_t> ring(_ring_capacity);
+
+    const size_t batch_size = size_t(1) << state.range(0);
+
+    uint64_t checksum = 0;
+
+    for (auto _ : state) {
+        for (size_t done = 0; done < batch_size;) {
+            size_t count;
+
+            if (state.thread_index() == 0) {
+                const std::span<uint8_t> span = ring.acquire_write(batch_size - done);
+                _decode(span, done);
+                ring.commit_write(count = span.size());
+            }
+            else {
+                const std::span<uint8_t> span = ring.acquire_read(batch_size - done);
+                checksum += _parse(span);
+                ring.release_read(count = span.size());
+            }
+
+            if (count == 0)
+                std::this_thread::yield();
+
+            done += count;
+        }
+    }
+
+    benchmark::DoNotOptimize(checksum);
+    state.SetBytesProcessed(state.iterations() * batch_size);
+}
+
+BENCHMARK(BM_handoff_locked_darray_swap)->DenseRange(8, 16, 4)->Threads(2)->UseRealTime();
+BENCHMARK(BM_handoff_spsc_ring)->DenseRange(8, 16, 4)->Threads(2)->UseRealTime();
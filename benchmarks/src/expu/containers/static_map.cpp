@@ -0,0 +1,51 @@
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <string_view>
+
+#include "expu/containers/flat_hash_map.hpp"
+#include "expu/containers/linear_map.hpp"
+#include "expu/containers/static_map.hpp"
+
+static constexpr std::pair<std::string_view, int> _header_names[] = {
+    { "accept", 0 },          { "accept-encoding", 1 }, { "accept-language", 2 }, { "authorization", 3 },
+    { "cache-control", 4 },   { "connection", 5 },      { "content-length", 6 },  { "content-type", 7 },
+    { "cookie", 8 },          { "date", 9 },            { "etag", 10 },           { "expect", 11 },
+    { "host", 12 },           { "if-match", 13 },       { "if-none-match", 14 },  { "last-modified", 15 },
+    { "location", 16 },       { "origin", 17 },         { "pragma", 18 },         { "range", 19 },
+    { "referer", 20 },        { "server", 21 },         { "set-cookie", 22 },     { "upgrade", 23 },
+    { "user-agent", 24 },     { "vary", 25 },           { "via", 26 },            { "warning", 27 } };
+
+template<class Map>
+static void BM_header_lookup(benchmark::State& state, const Map& map) {
+    for (auto _ : state)
+        for (const auto& [name, value] : _header_names)
+            benchmark::DoNotOptimize(map.find(name));
+
+    state.SetItemsProcessed(state.iterations() * std::size(_header_names));
+}
+
+static void BM_header_lookup_static_map(benchmark::State& state) {
+    static constexpr expu::static_map map(_header_names);
+    BM_header_lookup(state, map);
+}
+
+static void BM_header_lookup_linear_map(benchmark::State& state) {
+    expu::linear_map<std::string_view, int> map;
+    for (const auto& [name, value] : _header_names)
+        map[name] = value;
+
+    BM_header_lookup(state, map);
+}
+
+static void BM_header_lookup_flat_hash_map(benchmark::State& state) {
+    expu::flat_hash_map<std::string_view, int> map;
+    for (const auto& [name, value] : _header_names)
+        map[name] = value;
+
+    BM_header_lookup(state, map);
+}
+
+BENCHMARK(BM_header_lookup_static_map);
+BENCHMARK(BM_header_lookup_linear_map);
+BENCHMARK(BM_header_lookup_flat_hash_map);
@@ -10,8 +10,12 @@ function(add_gtest TEST_NAME SOURCES LIBRARIES)
     #ever arises. 
     target_link_libraries(${TEST_NAME} ${LIBRARIES} gtest gmock gtest_main)
 
+    #Optional TEST_PREFIX, distinguishing executables built from the same tests
+    cmake_parse_arguments(ARG "" "TEST_PREFIX" "" ${ARGN})
+
     gtest_discover_tests(
         ${TEST_NAME}
+        TEST_PREFIX "${ARG_TEST_PREFIX}"
         WORKING_DIRECTORY ${EXPU_TESTS_DIR})
 
     set_target_properties(${TEST_NAME} PROPERTIES FOLDER tests)
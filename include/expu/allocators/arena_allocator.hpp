@@ -0,0 +1,257 @@
+#ifndef EXPU_ALLOCATORS_ARENA_ALLOCATOR_HPP_INCLUDED
+#define EXPU_ALLOCATORS_ARENA_ALLOCATOR_HPP_INCLUDED
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>     //For access to bad_alloc and bad_array_new_length
+#include <type_traits>
+
+namespace expu {
+
+    //////////////////////////////////////ARENA///////////////////////////////////////////////////////////////////////////////
+
+
+    //Bump pointer memory resource. Allocations are carved from chunks, each twice the size of the last (up to
+    //max_chunk_size), which are only returned once the arena is reset, released or destroyed.
+    //Hence deallocation is a no-op, and freeing every allocation costs a single reset.
+    //Note: Not thread safe.
+    class arena
+    {
+    private:
+        //Precedes the usable bytes of each chunk, chaining chunks from newest to oldest.
+        struct _chunk_header
+        {
+            _chunk_header* previous;
+            size_t         size; //In bytes, including the header
+        };
+
+        static constexpr size_t _header_size =
+            (sizeof(_chunk_header) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+    public:
+        static constexpr size_t default_initial_chunk_size = size_t(1) << 12;
+        static constexpr size_t default_max_chunk_size     = size_t(1) << 24;
+
+    public:
+        explicit arena(
+            const size_t initial_chunk_size = default_initial_chunk_size,
+            const size_t max_chunk_size     = default_max_chunk_size) noexcept :
+            _next_chunk_size(std::max(initial_chunk_size, _header_size + 1)),
+            _max_chunk_size(std::max(max_chunk_size, _next_chunk_size)) {}
+
+        arena(const arena&)            = delete;
+        arena& operator=(const arena&) = delete;
+
+        ~arena() noexcept
+        {
+            release();
+        }
+
+    public:
+        [[nodiscard]] void* allocate(const size_t bytes, const size_t alignment = alignof(std::max_align_t))
+        {
+            std::byte* first = _align(_cursor, alignment);
+
+            if (!_fits(first, bytes)) {
+                _push_chunk(bytes, alignment);
+                first = _align(_cursor, alignment);
+            }
+
+            _cursor = first + bytes;
+            return first;
+        }
+
+        //Memory is only reclaimed by reset or release
+        void deallocate(void* const, const size_t, const size_t = alignof(std::max_align_t)) noexcept {}
+
+        //Resizes the allocation at ptr from old_bytes to new_bytes, without moving it. Only possible for the most
+        //recent allocation, whilst its chunk has room. Hence a lone growing array is seldom copied.
+        [[nodiscard]] bool try_expand(void* const ptr, const size_t old_bytes, const size_t new_bytes) noexcept
+        {
+            std::byte* const first = static_cast<std::byte*>(ptr);
+
+            if (first + old_bytes != _cursor || static_cast<size_t>(_end - first) < new_bytes)
+                return false;
+
+            _cursor = first + new_bytes;
+            return true;
+        }
+
+        //Frees every allocation at once. The newest (and largest) chunk is kept for reuse.
+        void reset() noexcept
+        {
+            if (!_head)
+                return;
+
+            _free_chunks(_head->previous);
+            _head->previous = nullptr;
+
+            _cursor = reinterpret_cast<std::byte*>(_head) + _header_size;
+        }
+
+        //Frees every allocation, returning all chunks to the system.
+        void release() noexcept
+        {
+            _free_chunks(_head);
+
+            _head   = nullptr;
+            _cursor = nullptr;
+            _end    = nullptr;
+        }
+
+    public:
+        //Bytes held by all chunks, whether used or not
+        [[nodiscard]] size_t capacity() const noexcept
+        {
+            size_t total = 0;
+            for (const _chunk_header* chunk = _head; chunk; chunk = chunk->previous)
+                total += chunk->size;
+
+            return total;
+        }
+
+        [[nodiscard]] size_t chunk_count() const noexcept
+        {
+            size_t count = 0;
+            for (const _chunk_header* chunk = _head; chunk; chunk = chunk->previous)
+                ++count;
+
+            return count;
+        }
+
+    private:
+        [[nodiscard]] static std::byte* _align(std::byte* const ptr, const size_t alignment) noexcept
+        {
+            const auto address = reinterpret_cast<uintptr_t>(ptr);
+            return ptr + (((address + alignment - 1) & ~(alignment - 1)) - address);
+        }
+
+        //Whether bytes starting at first, the aligned cursor, lie within the current chunk
+        [[nodiscard]] bool _fits(std::byte* const first, const size_t bytes) const noexcept
+        {
+            if (!_cursor)
+                return false;
+
+            const auto remaining = static_cast<size_t>(_end - _cursor);
+            const auto padding   = static_cast<size_t>(first - _cursor);
+
+            return padding <= remaining && bytes <= remaining - padding;
+        }
+
+        //Chains a new chunk able to hold bytes at alignment. Oversized requests get a chunk of their own size.
+        void _push_chunk(const size_t bytes, const size_t alignment)
+        {
+            //Note: Chunks are max_align_t aligned, hence only greater alignments require padding
+            const size_t padding = alignment > alignof(std::max_align_t) ? alignment - 1 : 0;
+
+            if (std::numeric_limits<size_t>::max() - _header_size - padding < bytes)
+                throw std::bad_array_new_length();
+
+            const size_t required   = _header_size + padding + bytes;
+            const size_t chunk_size = std::max(_next_chunk_size, required);
+
+            auto* const chunk = static_cast<_chunk_header*>(::operator new(chunk_size));
+            chunk->previous = _head;
+            chunk->size     = chunk_size;
+
+            _head   = chunk;
+            _cursor = reinterpret_cast<std::byte*>(chunk) + _header_size;
+            _end    = reinterpret_cast<std::byte*>(chunk) + chunk_size;
+
+            _next_chunk_size = std::min(_next_chunk_size * 2, _max_chunk_size);
+        }
+
+        static void _free_chunks(_chunk_header* chunk) noexcept
+        {
+            while (chunk) {
+                _chunk_header* const previous = chunk->previous;
+                ::operator delete(chunk, chunk->size);
+                chunk = previous;
+            }
+        }
+
+    private:
+        _chunk_header* _head   = nullptr;
+        std::byte*     _cursor = nullptr;
+        std::byte*     _end    = nullptr;
+
+        size_t _next_chunk_size;
+        size_t _max_chunk_size;
+    };
+
+
+    //////////////////////////////////////ARENA ALLOCATOR///////////////////////////////////////////////////////////////////////////////
+
+
+    //Allocator drawing from an expu::arena, which must outlive any container using it.
+    //Note: Allocators compare equal iff they share an arena. Moving or swapping containers carries the arena along.
+    template<class Type>
+    class arena_allocator
+    {
+    public:
+        using value_type      = Type;
+        using size_type       = size_t;
+        using difference_type = ptrdiff_t;
+
+        using is_always_equal                        = std::false_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap            = std::true_type;
+
+        template<class OtherType>
+        struct rebind { using other = arena_allocator<OtherType>; };
+
+    public:
+        constexpr arena_allocator(arena& resource) noexcept :
+            _arena(std::addressof(resource)) {}
+
+        template<class OtherType>
+        constexpr arena_allocator(const arena_allocator<OtherType>& other) noexcept :
+            _arena(other._arena) {}
+
+    private:
+        template<class>
+        friend class arena_allocator;
+
+    public:
+        [[nodiscard]] constexpr size_type max_size() const noexcept
+        {
+            return std::numeric_limits<size_type>::max() / sizeof(Type);
+        }
+
+        [[nodiscard]] Type* allocate(const size_type n)
+        {
+            if (max_size() < n)
+                throw std::bad_array_new_length();
+
+            return static_cast<Type*>(_arena->allocate(n * sizeof(Type), alignof(Type)));
+        }
+
+        void deallocate(Type* const ptr, const size_type n) noexcept
+        {
+            _arena->deallocate(ptr, n * sizeof(Type), alignof(Type));
+        }
+
+    public: //Allocator extensions (see expu::allocator_try_expand)
+        [[nodiscard]] bool try_expand(Type* const ptr, const size_type old_n, const size_type new_n) noexcept
+        {
+            return new_n <= max_size() && _arena->try_expand(ptr, old_n * sizeof(Type), new_n * sizeof(Type));
+        }
+
+    public:
+        [[nodiscard]] constexpr arena& resource() const noexcept { return *_arena; }
+
+        template<class OtherType>
+        [[nodiscard]] constexpr bool operator==(const arena_allocator<OtherType>& other) const noexcept
+        {
+            return _arena == other._arena;
+        }
+
+    private:
+        arena* _arena;
+    };
+}
+
+#endif // !EXPU_ALLOCATORS_ARENA_ALLOCATOR_HPP_INCLUDED
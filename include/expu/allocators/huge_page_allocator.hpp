@@ -0,0 +1,153 @@
+#ifndef EXPU_ALLOCATORS_HUGE_PAGE_ALLOCATOR_HPP_INCLUDED
+#define EXPU_ALLOCATORS_HUGE_PAGE_ALLOCATOR_HPP_INCLUDED
+
+#include <cstdint> //For access to uintptr_t
+#include <memory>  //For access to std::allocator
+#include <new>     //For access to bad_alloc and bad_array_new_length
+#include <limits>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif // __linux__
+
+namespace expu {
+
+    //////////////////////////////////////HUGE PAGE MAPPING///////////////////////////////////////////////////////////////////////////////
+
+
+    //Size of the default huge page on x86-64 and aarch64 Linux
+    inline constexpr size_t _huge_page_size = size_t(1) << 21;
+
+    [[nodiscard]] constexpr size_t _huge_page_rounded(const size_t bytes) noexcept
+    {
+        return (bytes + _huge_page_size - 1) & ~(_huge_page_size - 1);
+    }
+
+#ifdef __linux__
+    //Maps size bytes, a multiple of _huge_page_size, backed by huge pages where possible. Explicitly reserved huge
+    //pages (MAP_HUGETLB) are tried first, otherwise the mapping is aligned to a huge page and marked for transparent
+    //huge pages (MADV_HUGEPAGE). Returns nullptr if the mapping fails.
+    [[nodiscard]] inline void* _map_huge_pages(const size_t size) noexcept
+    {
+        constexpr int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+#ifdef MAP_HUGETLB
+    #ifdef MAP_HUGE_2MB
+        constexpr int huge_flags = flags | MAP_HUGETLB | MAP_HUGE_2MB;
+    #else
+        constexpr int huge_flags = flags | MAP_HUGETLB;
+    #endif
+
+        //Note: Fails immediately unless enough huge pages have been reserved (see /proc/sys/vm/nr_hugepages)
+        if (void* const result = mmap(nullptr, size, PROT_READ | PROT_WRITE, huge_flags, -1, 0); result != MAP_FAILED)
+            return result;
+#endif // MAP_HUGETLB
+
+        //Over map by a huge page, so that an aligned range can be cut out of it
+        void* const mapped = mmap(nullptr, size + _huge_page_size, PROT_READ | PROT_WRITE, flags, -1, 0);
+        if (mapped == MAP_FAILED)
+            return nullptr;
+
+        char* const first   = static_cast<char*>(mapped);
+        char* const aligned = reinterpret_cast<char*>(_huge_page_rounded(reinterpret_cast<uintptr_t>(first)));
+
+        if (aligned != first)
+            munmap(first, static_cast<size_t>(aligned - first));
+
+        if (const size_t tail = _huge_page_size - static_cast<size_t>(aligned - first); tail != 0)
+            munmap(aligned + size, tail);
+
+#ifdef MADV_HUGEPAGE
+        //Note: Only a hint, ignored if transparent huge pages are disabled
+        madvise(aligned, size, MADV_HUGEPAGE);
+#endif // MADV_HUGEPAGE
+
+        return aligned;
+    }
+#endif // __linux__
+
+
+    //////////////////////////////////////HUGE PAGE ALLOCATOR///////////////////////////////////////////////////////////////////////////////
+
+
+    //Allocator which maps allocations of at least HugeThreshold bytes directly from the OS, backed by huge pages
+    //where possible (see _map_huge_pages), such that large arrays need far fewer TLB entries. Smaller allocations
+    //are forwarded to std::allocator.
+    //Note: Mapped allocations are rounded up to whole huge pages. On non-Linux platforms, this behaves exactly as
+    //std::allocator.
+    template<class Type, size_t HugeThreshold = _huge_page_size>
+    class huge_page_allocator
+    {
+    public:
+        using value_type      = Type;
+        using size_type       = size_t;
+        using difference_type = ptrdiff_t;
+
+        using is_always_equal                        = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+
+        template<class OtherType>
+        struct rebind { using other = huge_page_allocator<OtherType, HugeThreshold>; };
+
+    public:
+        constexpr huge_page_allocator() noexcept = default;
+
+        template<class OtherType>
+        constexpr huge_page_allocator(const huge_page_allocator<OtherType, HugeThreshold>&) noexcept {}
+
+    private:
+        [[nodiscard]] static constexpr bool _is_mapped(const size_type n) noexcept
+        {
+#ifdef __linux__
+            return HugeThreshold <= n * sizeof(Type);
+#else
+            (void)n;
+            return false;
+#endif // __linux__
+        }
+
+    public:
+        [[nodiscard]] constexpr size_type max_size() const noexcept
+        {
+            return (std::numeric_limits<size_type>::max() - _huge_page_size) / sizeof(Type);
+        }
+
+        [[nodiscard]] Type* allocate(const size_type n)
+        {
+            if (max_size() < n)
+                throw std::bad_array_new_length();
+
+#ifdef __linux__
+            if (_is_mapped(n)) {
+                void* const result = _map_huge_pages(_huge_page_rounded(n * sizeof(Type)));
+                if (!result)
+                    throw std::bad_alloc();
+
+                return static_cast<Type*>(result);
+            }
+#endif // __linux__
+
+            return std::allocator<Type>().allocate(n);
+        }
+
+        void deallocate(Type* const ptr, const size_type n) noexcept
+        {
+#ifdef __linux__
+            if (_is_mapped(n)) {
+                munmap(ptr, _huge_page_rounded(n * sizeof(Type)));
+                return;
+            }
+#endif // __linux__
+
+            std::allocator<Type>().deallocate(ptr, n);
+        }
+    };
+
+    template<class Type, class OtherType, size_t HugeThreshold>
+    constexpr bool operator==(const huge_page_allocator<Type, HugeThreshold>&, const huge_page_allocator<OtherType, HugeThreshold>&) noexcept
+    {
+        return true;
+    }
+}
+
+#endif // !EXPU_ALLOCATORS_HUGE_PAGE_ALLOCATOR_HPP_INCLUDED
@@ -0,0 +1,131 @@
+#ifndef EXPU_ALLOCATORS_MREMAP_ALLOCATOR_HPP_INCLUDED
+#define EXPU_ALLOCATORS_MREMAP_ALLOCATOR_HPP_INCLUDED
+
+#include <memory>  //For access to std::allocator
+#include <new>     //For access to bad_alloc and bad_array_new_length
+#include <limits>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif // __linux__
+
+namespace expu {
+
+    //Allocator which maps allocations of at least MmapThreshold bytes directly from the OS, such that they may later
+    //be grown via mremap without copying. Smaller allocations are forwarded to std::allocator.
+    //Note: On platforms without mremap, this behaves exactly as std::allocator.
+    template<class Type, size_t MmapThreshold = (size_t(1) << 20)>
+    class mremap_allocator
+    {
+    public:
+        using value_type      = Type;
+        using size_type       = size_t;
+        using difference_type = ptrdiff_t;
+
+        using is_always_equal                        = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+
+        template<class OtherType>
+        struct rebind { using other = mremap_allocator<OtherType, MmapThreshold>; };
+
+    public:
+        constexpr mremap_allocator() noexcept = default;
+
+        template<class OtherType>
+        constexpr mremap_allocator(const mremap_allocator<OtherType, MmapThreshold>&) noexcept {}
+
+    private:
+        [[nodiscard]] static constexpr bool _is_mapped(const size_type n) noexcept
+        {
+#ifdef __linux__
+            return MmapThreshold <= n * sizeof(Type);
+#else
+            (void)n;
+            return false;
+#endif // __linux__
+        }
+
+#ifdef __linux__
+        [[nodiscard]] static size_t _mapped_size(const size_type n) noexcept
+        {
+            static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+            const size_t bytes = n * sizeof(Type);
+            return (bytes + page_size - 1) & ~(page_size - 1);
+        }
+#endif // __linux__
+
+    public:
+        [[nodiscard]] constexpr size_type max_size() const noexcept
+        {
+            return std::numeric_limits<size_type>::max() / sizeof(Type);
+        }
+
+        [[nodiscard]] Type* allocate(const size_type n)
+        {
+            if (max_size() < n)
+                throw std::bad_array_new_length();
+
+#ifdef __linux__
+            if (_is_mapped(n)) {
+                void* const result = mmap(nullptr, _mapped_size(n), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (result == MAP_FAILED)
+                    throw std::bad_alloc();
+
+                return static_cast<Type*>(result);
+            }
+#endif // __linux__
+
+            return std::allocator<Type>().allocate(n);
+        }
+
+        void deallocate(Type* const ptr, const size_type n) noexcept
+        {
+#ifdef __linux__
+            if (_is_mapped(n)) {
+                munmap(ptr, _mapped_size(n));
+                return;
+            }
+#endif // __linux__
+
+            std::allocator<Type>().deallocate(ptr, n);
+        }
+
+    public: //Allocator extensions (see expu::allocator_try_expand and expu::allocator_try_reallocate)
+        [[nodiscard]] bool try_expand(Type* const ptr, const size_type old_n, const size_type new_n) noexcept
+        {
+            if (!_is_mapped(old_n) || !_is_mapped(new_n))
+                return false;
+
+#ifdef __linux__
+            return mremap(ptr, _mapped_size(old_n), _mapped_size(new_n), 0) != MAP_FAILED;
+#else
+            (void)ptr;
+            return false;
+#endif // __linux__
+        }
+
+        [[nodiscard]] Type* try_reallocate(Type* const ptr, const size_type old_n, const size_type new_n) noexcept
+        {
+            if (!_is_mapped(old_n) || !_is_mapped(new_n))
+                return nullptr;
+
+#ifdef __linux__
+            void* const result = mremap(ptr, _mapped_size(old_n), _mapped_size(new_n), MREMAP_MAYMOVE);
+            return result != MAP_FAILED ? static_cast<Type*>(result) : nullptr;
+#else
+            (void)ptr;
+            return nullptr;
+#endif // __linux__
+        }
+    };
+
+    template<class Type, class OtherType, size_t MmapThreshold>
+    constexpr bool operator==(const mremap_allocator<Type, MmapThreshold>&, const mremap_allocator<OtherType, MmapThreshold>&) noexcept
+    {
+        return true;
+    }
+}
+
+#endif // !EXPU_ALLOCATORS_MREMAP_ALLOCATOR_HPP_INCLUDED
@@ -0,0 +1,197 @@
+#ifndef EXPU_ALLOCATORS_NUMA_ALLOCATOR_HPP_INCLUDED
+#define EXPU_ALLOCATORS_NUMA_ALLOCATOR_HPP_INCLUDED
+
+#include <climits> //For access to CHAR_BIT
+#include <memory>  //For access to std::allocator
+#include <new>     //For access to bad_alloc and bad_array_new_length
+#include <limits>
+
+#include "expu/allocators/huge_page_allocator.hpp"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif // __linux__
+
+namespace expu {
+
+    //////////////////////////////////////NUMA POLICIES///////////////////////////////////////////////////////////////////////////////
+
+
+    enum class numa_policy
+    {
+        local,     //Pages are placed on the node of the thread which first touches them, the OS default
+        bind,      //Pages are placed only on the given nodes
+        interleave //Pages are spread round robin across the given nodes
+    };
+
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_get_mempolicy)
+    #define EXPU_HAS_MBIND 1
+
+    //Kernel memory policy constants, as in <numaif.h>, which is otherwise only shipped alongside libnuma
+    inline constexpr int _mpol_bind           = 2;
+    inline constexpr int _mpol_interleave     = 3;
+    inline constexpr int _mpol_f_mems_allowed = 1 << 2;
+
+    inline constexpr unsigned long _numa_max_nodes = sizeof(unsigned long) * CHAR_BIT;
+
+    //Nodes this process may allocate from, or 0 if they cannot be determined
+    [[nodiscard]] inline unsigned long _numa_allowed_nodes() noexcept
+    {
+        static const unsigned long allowed = [] {
+            unsigned long mask = 0;
+            return syscall(SYS_get_mempolicy, nullptr, &mask, _numa_max_nodes, nullptr, _mpol_f_mems_allowed) == 0 ? mask : 0ul;
+        }();
+
+        return allowed;
+    }
+
+    //Applies policy to the mapped pages of [ptr, ptr + size), restricted to the nodes this process may use.
+    //Note: Best effort, on failure pages are placed as per numa_policy::local
+    inline void _numa_apply_policy(void* const ptr, const size_t size, const numa_policy policy, unsigned long node_mask) noexcept
+    {
+        if (policy == numa_policy::local)
+            return;
+
+        if (const unsigned long allowed = _numa_allowed_nodes())
+            node_mask &= allowed;
+
+        if (node_mask == 0)
+            return;
+
+        //Note: The kernel ignores the last bit of maxnode, hence + 1
+        const int mode = policy == numa_policy::bind ? _mpol_bind : _mpol_interleave;
+        syscall(SYS_mbind, ptr, size, mode, &node_mask, _numa_max_nodes + 1, 0u);
+    }
+#endif // EXPU_HAS_MBIND
+
+
+    //////////////////////////////////////NUMA ALLOCATOR///////////////////////////////////////////////////////////////////////////////
+
+
+    //Allocator which maps allocations of at least MmapThreshold bytes directly from the OS, then binds their pages to,
+    //or interleaves them across, the nodes of node_mask (bit i for node i) via mbind. Smaller allocations are forwarded
+    //to std::allocator, as policies apply to whole pages. If HugePages is set, mappings are instead backed by huge
+    //pages where possible (see _map_huge_pages).
+    //Note: Policies are per mapping, rather than per thread as with set_mempolicy, hence leave the placement of every
+    //other allocation untouched. Where mbind is unavailable, pages are placed as per numa_policy::local.
+    template<class Type, size_t MmapThreshold = (size_t(1) << 20), bool HugePages = false>
+    class numa_allocator
+    {
+    public:
+        using value_type      = Type;
+        using size_type       = size_t;
+        using difference_type = ptrdiff_t;
+
+        //Note: Memory may be deallocated regardless of policy, yet the policy travels with the data
+        using is_always_equal                        = std::true_type;
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap            = std::true_type;
+
+        template<class OtherType>
+        struct rebind { using other = numa_allocator<OtherType, MmapThreshold, HugePages>; };
+
+    public:
+        constexpr numa_allocator() noexcept = default;
+
+        constexpr numa_allocator(const numa_policy policy, const unsigned long node_mask) noexcept :
+            _policy(policy), _node_mask(node_mask) {}
+
+        template<class OtherType>
+        constexpr numa_allocator(const numa_allocator<OtherType, MmapThreshold, HugePages>& other) noexcept :
+            _policy(other.policy()), _node_mask(other.node_mask()) {}
+
+    private:
+        [[nodiscard]] static constexpr bool _is_mapped(const size_type n) noexcept
+        {
+#ifdef __linux__
+            return MmapThreshold <= n * sizeof(Type);
+#else
+            (void)n;
+            return false;
+#endif // __linux__
+        }
+
+#ifdef __linux__
+        [[nodiscard]] static size_t _mapped_size(const size_type n) noexcept
+        {
+            if constexpr (HugePages)
+                return _huge_page_rounded(n * sizeof(Type));
+            else {
+                static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+                const size_t bytes = n * sizeof(Type);
+                return (bytes + page_size - 1) & ~(page_size - 1);
+            }
+        }
+#endif // __linux__
+
+    public:
+        [[nodiscard]] constexpr size_type max_size() const noexcept
+        {
+            return (std::numeric_limits<size_type>::max() - _huge_page_size) / sizeof(Type);
+        }
+
+        [[nodiscard]] Type* allocate(const size_type n)
+        {
+            if (max_size() < n)
+                throw std::bad_array_new_length();
+
+#ifdef __linux__
+            if (_is_mapped(n)) {
+                const size_t size = _mapped_size(n);
+
+                void* result;
+                if constexpr (HugePages)
+                    result = _map_huge_pages(size);
+                else {
+                    result = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                    result = result != MAP_FAILED ? result : nullptr;
+                }
+
+                if (!result)
+                    throw std::bad_alloc();
+
+#ifdef EXPU_HAS_MBIND
+                //Note: Pages are yet to be touched, hence are placed as per policy when first written
+                _numa_apply_policy(result, size, _policy, _node_mask);
+#endif // EXPU_HAS_MBIND
+
+                return static_cast<Type*>(result);
+            }
+#endif // __linux__
+
+            return std::allocator<Type>().allocate(n);
+        }
+
+        void deallocate(Type* const ptr, const size_type n) noexcept
+        {
+#ifdef __linux__
+            if (_is_mapped(n)) {
+                munmap(ptr, _mapped_size(n));
+                return;
+            }
+#endif // __linux__
+
+            std::allocator<Type>().deallocate(ptr, n);
+        }
+
+    public: //Getters
+        [[nodiscard]] constexpr numa_policy   policy()    const noexcept { return _policy; }
+        [[nodiscard]] constexpr unsigned long node_mask() const noexcept { return _node_mask; }
+
+    private:
+        numa_policy   _policy    = numa_policy::local;
+        unsigned long _node_mask = 0;
+    };
+
+    template<class Type, class OtherType, size_t MmapThreshold, bool HugePages>
+    constexpr bool operator==(const numa_allocator<Type, MmapThreshold, HugePages>&, const numa_allocator<OtherType, MmapThreshold, HugePages>&) noexcept
+    {
+        return true;
+    }
+}
+
+#endif // !EXPU_ALLOCATORS_NUMA_ALLOCATOR_HPP_INCLUDED
@@ -0,0 +1,263 @@
+#ifndef EXPU_ALLOCATORS_POOL_ALLOCATOR_HPP_INCLUDED
+#define EXPU_ALLOCATORS_POOL_ALLOCATOR_HPP_INCLUDED
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>     //For access to bad_alloc and bad_array_new_length
+#include <type_traits>
+
+namespace expu {
+
+    //////////////////////////////////////POOL///////////////////////////////////////////////////////////////////////////////
+
+
+    //Memory resource serving small allocations from per size class free lists. Each class holds blocks of a power of
+    //two bytes, carved from slabs which are only returned to the system once the pool is released or destroyed.
+    //Allocations larger than max_pooled_bytes, or more aligned than a block guarantees, are forwarded to operator new.
+    //Note: Not thread safe, see thread_local_pool for a pool per thread.
+    class pool
+    {
+    private:
+        //Free blocks are chained through their first bytes
+        struct _free_block
+        {
+            _free_block* next;
+        };
+
+        //Precedes the blocks of each slab, chaining slabs for release.
+        struct _slab_header
+        {
+            _slab_header* previous;
+            size_t        size; //In bytes, including the header
+        };
+
+        struct _size_class
+        {
+            _free_block* free_list = nullptr;
+
+            //Unused remainder of the newest slab of this class
+            std::byte* cursor = nullptr;
+            std::byte* end    = nullptr;
+        };
+
+        static constexpr size_t _min_block_size  = 16;
+        static constexpr size_t _max_class_count = std::numeric_limits<size_t>::digits;
+
+        static constexpr size_t _header_size =
+            (sizeof(_slab_header) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+    public:
+        static constexpr size_t default_max_pooled_bytes = size_t(1) << 12;
+        static constexpr size_t default_slab_bytes       = size_t(1) << 16;
+
+    public:
+        explicit pool(
+            const size_t max_pooled_bytes = default_max_pooled_bytes,
+            const size_t slab_bytes       = default_slab_bytes) noexcept :
+            _max_pooled_bytes(std::bit_ceil(std::max(max_pooled_bytes, _min_block_size))),
+            _slab_bytes(slab_bytes) {}
+
+        pool(const pool&)            = delete;
+        pool& operator=(const pool&) = delete;
+
+        ~pool() noexcept
+        {
+            release();
+        }
+
+    public:
+        [[nodiscard]] void* allocate(const size_t bytes, const size_t alignment = alignof(std::max_align_t))
+        {
+            if (!_is_pooled(bytes, alignment))
+                return ::operator new(bytes, std::align_val_t(alignment));
+
+            _size_class& size_class = _classes[_class_of(bytes)];
+
+            if (_free_block* const block = size_class.free_list) {
+                size_class.free_list = block->next;
+                return block;
+            }
+
+            const size_t block_size = _block_size(bytes);
+
+            if (static_cast<size_t>(size_class.end - size_class.cursor) < block_size)
+                _push_slab(size_class, block_size);
+
+            std::byte* const block = size_class.cursor;
+            size_class.cursor += block_size;
+
+            return block;
+        }
+
+        void deallocate(void* const ptr, const size_t bytes, const size_t alignment = alignof(std::max_align_t)) noexcept
+        {
+            if (!_is_pooled(bytes, alignment)) {
+                ::operator delete(ptr, bytes, std::align_val_t(alignment));
+                return;
+            }
+
+            _size_class& size_class = _classes[_class_of(bytes)];
+
+            size_class.free_list = ::new(ptr) _free_block{ size_class.free_list };
+        }
+
+        //Whether an allocation of old_bytes may hold new_bytes without moving, that is, both are pooled and share a
+        //size class. Note: Allocations not served by the pool never expand.
+        [[nodiscard]] bool try_expand(void* const, const size_t old_bytes, const size_t new_bytes, const size_t alignment = alignof(std::max_align_t)) const noexcept
+        {
+            return _is_pooled(old_bytes, alignment) && _is_pooled(new_bytes, alignment) && _class_of(old_bytes) == _class_of(new_bytes);
+        }
+
+        //Returns all slabs to the system, invalidating every pooled allocation.
+        void release() noexcept
+        {
+            while (_slabs) {
+                _slab_header* const previous = _slabs->previous;
+                ::operator delete(_slabs, _slabs->size);
+                _slabs = previous;
+            }
+
+            _classes = {};
+        }
+
+    public:
+        [[nodiscard]] size_t max_pooled_bytes() const noexcept { return _max_pooled_bytes; }
+
+        //Bytes held by all slabs, whether in use or not
+        [[nodiscard]] size_t capacity() const noexcept
+        {
+            size_t total = 0;
+            for (const _slab_header* slab = _slabs; slab; slab = slab->previous)
+                total += slab->size;
+
+            return total;
+        }
+
+    private:
+        //Note: Blocks are placed at multiples of their size from a max_align_t aligned address
+        [[nodiscard]] bool _is_pooled(const size_t bytes, const size_t alignment) const noexcept
+        {
+            return bytes <= _max_pooled_bytes && alignment <= std::min(_block_size(bytes), alignof(std::max_align_t));
+        }
+
+        [[nodiscard]] static constexpr size_t _block_size(const size_t bytes) noexcept
+        {
+            return std::bit_ceil(std::max(bytes, _min_block_size));
+        }
+
+        [[nodiscard]] static constexpr size_t _class_of(const size_t bytes) noexcept
+        {
+            return static_cast<size_t>(std::countr_zero(_block_size(bytes) / _min_block_size));
+        }
+
+        void _push_slab(_size_class& size_class, const size_t block_size)
+        {
+            //Note: The old slab's remainder is smaller than a block, hence is simply abandoned
+            const size_t slab_size = _header_size + std::max(_slab_bytes, block_size);
+
+            auto* const slab = static_cast<_slab_header*>(::operator new(slab_size));
+            slab->previous = _slabs;
+            slab->size     = slab_size;
+
+            _slabs = slab;
+
+            size_class.cursor = reinterpret_cast<std::byte*>(slab) + _header_size;
+            size_class.end    = size_class.cursor + (slab_size - _header_size) / block_size * block_size;
+        }
+
+    private:
+        std::array<_size_class, _max_class_count> _classes = {};
+        _slab_header*                             _slabs   = nullptr;
+
+        size_t _max_pooled_bytes;
+        size_t _slab_bytes;
+    };
+
+    //Pool owned by the calling thread, released when the thread exits. Hence allocating from it never contends with
+    //other threads, but memory drawn from it must be freed on, and must not outlive, the same thread.
+    [[nodiscard]] inline pool& thread_local_pool() noexcept
+    {
+        thread_local pool instance;
+        return instance;
+    }
+
+
+    //////////////////////////////////////POOL ALLOCATOR///////////////////////////////////////////////////////////////////////////////
+
+
+    //Allocator drawing from an expu::pool, which must outlive any container using it. Pools are not thread safe, hence
+    //there is no default pool; for the calling thread's own, construct from thread_local_pool() explicitly.
+    //Note: Allocators compare equal iff they share a pool. Moving or swapping containers carries the pool along,
+    //whereas copies keep their own (see darray's handling of propagate_on_container_* traits).
+    template<class Type>
+    class pool_allocator
+    {
+    public:
+        using value_type      = Type;
+        using size_type       = size_t;
+        using difference_type = ptrdiff_t;
+
+        using is_always_equal                        = std::false_type;
+        using propagate_on_container_copy_assignment = std::false_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap            = std::true_type;
+
+        template<class OtherType>
+        struct rebind { using other = pool_allocator<OtherType>; };
+
+    public:
+        constexpr pool_allocator(pool& resource) noexcept :
+            _pool(std::addressof(resource)) {}
+
+        template<class OtherType>
+        constexpr pool_allocator(const pool_allocator<OtherType>& other) noexcept :
+            _pool(other._pool) {}
+
+    private:
+        template<class>
+        friend class pool_allocator;
+
+    public:
+        [[nodiscard]] constexpr size_type max_size() const noexcept
+        {
+            return std::numeric_limits<size_type>::max() / sizeof(Type);
+        }
+
+        [[nodiscard]] Type* allocate(const size_type n)
+        {
+            if (max_size() < n)
+                throw std::bad_array_new_length();
+
+            return static_cast<Type*>(_pool->allocate(n * sizeof(Type), alignof(Type)));
+        }
+
+        void deallocate(Type* const ptr, const size_type n) noexcept
+        {
+            _pool->deallocate(ptr, n * sizeof(Type), alignof(Type));
+        }
+
+    public: //Allocator extensions (see expu::allocator_try_expand)
+        [[nodiscard]] bool try_expand(Type* const ptr, const size_type old_n, const size_type new_n) const noexcept
+        {
+            return new_n <= max_size() && _pool->try_expand(ptr, old_n * sizeof(Type), new_n * sizeof(Type), alignof(Type));
+        }
+
+    public:
+        [[nodiscard]] constexpr pool& resource() const noexcept { return *_pool; }
+
+        template<class OtherType>
+        [[nodiscard]] constexpr bool operator==(const pool_allocator<OtherType>& other) const noexcept
+        {
+            return _pool == other._pool;
+        }
+
+    private:
+        pool* _pool;
+    };
+}
+
+#endif // !EXPU_ALLOCATORS_POOL_ALLOCATOR_HPP_INCLUDED
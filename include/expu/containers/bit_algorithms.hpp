@@ -0,0 +1,339 @@
+#ifndef EXPU_CONTAINERS_BIT_ALGORITHMS_HPP_INCLUDED
+#define EXPU_CONTAINERS_BIT_ALGORITHMS_HPP_INCLUDED
+
+#include <bit>         //For access to popcount, countr_zero and endian
+#include <cstdint>     //For access to fixed width integer types
+#include <cstring>     //For access to memcpy and memset
+#include <algorithm>   //For access to min
+
+#include "expu/containers/contiguous_container.hpp"
+
+//Algorithms over packed bool ranges which operate on 64 bits at a time, rather than one _bool_index at a time.
+//Found by overload on _ctg_bool_const_iterator, hence apply to every container storing packed bools.
+
+namespace expu {
+
+    //////////////////////////////////////WORD HELPERS///////////////////////////////////////////////////////////////////////////////
+
+
+    inline constexpr size_t _bits_per_word = 64;
+
+    [[nodiscard]] constexpr uint64_t _low_bits_mask(const size_t bit_count) noexcept
+    {
+        return bit_count >= _bits_per_word ? ~uint64_t(0) : (uint64_t(1) << bit_count) - 1;
+    }
+
+    //Reads byte_count (at most 8) bytes as a little endian word.
+    [[nodiscard]] inline uint64_t _load_word(const uint8_t* const bytes, const size_t byte_count) noexcept
+    {
+        uint64_t word = 0;
+
+        if constexpr (std::endian::native == std::endian::little) {
+            if (byte_count == sizeof(word))
+                std::memcpy(&word, bytes, sizeof(word));
+            else
+                std::memcpy(&word, bytes, byte_count);
+        }
+        else {
+            for (size_t index = 0; index < byte_count; ++index)
+                word |= uint64_t(bytes[index]) << (index << 3);
+        }
+
+        return word;
+    }
+
+    //Writes the low byte_count (at most 8) bytes of word, little endian.
+    inline void _store_word(uint8_t* const bytes, const size_t byte_count, const uint64_t word) noexcept
+    {
+        if constexpr (std::endian::native == std::endian::little) {
+            if (byte_count == sizeof(word))
+                std::memcpy(bytes, &word, sizeof(word));
+            else
+                std::memcpy(bytes, &word, byte_count);
+        }
+        else {
+            for (size_t index = 0; index < byte_count; ++index)
+                bytes[index] = static_cast<uint8_t>(word >> (index << 3));
+        }
+    }
+
+    //Reads bit_count (at most 64) bits starting offset bits into bytes. Only the bytes holding them are read.
+    [[nodiscard]] inline uint64_t _load_bits(const uint8_t* const bytes, const size_t offset, const size_t bit_count) noexcept
+    {
+        const size_t byte_count = (offset + bit_count + 7) >> 3;
+
+        uint64_t word = _load_word(bytes, std::min<size_t>(byte_count, 8)) >> offset;
+        //Note: A ninth byte is only required when offset is non-zero.
+        if (byte_count > 8)
+            word |= uint64_t(bytes[8]) << (_bits_per_word - offset);
+
+        return word & _low_bits_mask(bit_count);
+    }
+
+    //Writes the low bit_count (at most 64) bits of value starting offset bits into bytes, preserving surrounding bits.
+    inline void _store_bits(uint8_t* const bytes, const size_t offset, const size_t bit_count, const uint64_t value) noexcept
+    {
+        const size_t   byte_count = (offset + bit_count + 7) >> 3;
+        const uint64_t mask       = _low_bits_mask(bit_count);
+
+        const size_t low_count = std::min<size_t>(byte_count, 8);
+        const uint64_t low_word = _load_word(bytes, low_count);
+        _store_word(bytes, low_count, (low_word & ~(mask << offset)) | ((value & mask) << offset));
+
+        if (byte_count > 8) {
+            const size_t high_shift = _bits_per_word - offset;
+            const auto   high_mask  = static_cast<uint8_t>(mask >> high_shift);
+
+            bytes[8] = static_cast<uint8_t>((bytes[8] & ~high_mask) | ((value >> high_shift) & high_mask));
+        }
+    }
+
+    //Calls word_op(word, bit_count) for each word of the range, stopping early if it returns true. Returns the
+    //bit index of the word at which iteration stopped, or the range size.
+    template<class BoolRangePair, class WordOp>
+    size_t _for_each_word(const _ctg_bool_const_iterator<BoolRangePair>& first, const size_t size, WordOp word_op)
+    {
+        const uint8_t* const bytes  = first._bit_ptr();
+        const size_t         offset = first._bit_offset();
+
+        size_t index = 0;
+
+        //Note: Byte aligned ranges load whole words directly.
+        if (offset == 0) {
+            for (; size - index >= _bits_per_word; index += _bits_per_word)
+                if (word_op(_load_word(bytes + (index >> 3), 8), _bits_per_word))
+                    return index;
+        }
+
+        for (; index < size; index += _bits_per_word) {
+            const size_t bit_count = std::min(_bits_per_word, size - index);
+
+            if (word_op(_load_bits(bytes + (index >> 3), offset, bit_count), bit_count))
+                return index;
+        }
+
+        return size;
+    }
+
+    //Writes word_op(index, bit_count) to each word of [first, first + size).
+    template<class BoolRangePair, class WordOp>
+    void _transform_words(const _ctg_bool_iterator<BoolRangePair>& first, const size_t size, WordOp word_op)
+    {
+        uint8_t* const bytes  = first._bit_ptr();
+        const size_t   offset = first._bit_offset();
+
+        for (size_t index = 0; index < size; index += _bits_per_word) {
+            const size_t bit_count = std::min(_bits_per_word, size - index);
+
+            _store_bits(bytes + (index >> 3), offset, bit_count, word_op(index, bit_count));
+        }
+    }
+
+    template<class BoolRangePair>
+    [[nodiscard]] uint64_t _load_word_at(const _ctg_bool_const_iterator<BoolRangePair>& first, const size_t index, const size_t bit_count) noexcept
+    {
+        return _load_bits(first._bit_ptr() + (index >> 3), first._bit_offset(), bit_count);
+    }
+
+
+    //////////////////////////////////////QUERIES///////////////////////////////////////////////////////////////////////////////
+
+
+    template<class BoolRangePair>
+    [[nodiscard]] auto count(
+        const _ctg_bool_const_iterator<BoolRangePair> first,
+        const _ctg_bool_const_iterator<BoolRangePair> last,
+        const bool value) noexcept
+    {
+        const auto size = static_cast<size_t>(last - first);
+
+        size_t set_count = 0;
+        _for_each_word(first, size, [&](const uint64_t word, size_t) {
+            set_count += static_cast<size_t>(std::popcount(word));
+            return false;
+        });
+
+        return static_cast<typename _ctg_bool_const_iterator<BoolRangePair>::difference_type>(value ? set_count : size - set_count);
+    }
+
+    template<class BoolRangePair>
+    [[nodiscard]] _ctg_bool_const_iterator<BoolRangePair> find(
+        const _ctg_bool_const_iterator<BoolRangePair> first,
+        const _ctg_bool_const_iterator<BoolRangePair> last,
+        const bool value) noexcept
+    {
+        const auto size = static_cast<size_t>(last - first);
+
+        size_t bit_index = 0;
+        const size_t word_index = _for_each_word(first, size, [&](uint64_t word, const size_t bit_count) {
+            if (!value)
+                word = ~word & _low_bits_mask(bit_count);
+
+            bit_index = static_cast<size_t>(std::countr_zero(word));
+            return word != 0;
+        });
+
+        if (word_index == size)
+            return last;
+
+        return first + static_cast<std::iter_difference_t<_ctg_bool_const_iterator<BoolRangePair>>>(word_index + bit_index);
+    }
+
+    template<class BoolRangePair>
+    [[nodiscard]] _ctg_bool_iterator<BoolRangePair> find(
+        const _ctg_bool_iterator<BoolRangePair> first,
+        const _ctg_bool_iterator<BoolRangePair> last,
+        const bool value) noexcept
+    {
+        using const_iterator = _ctg_bool_const_iterator<BoolRangePair>;
+
+        const auto found = find(static_cast<const_iterator>(first), static_cast<const_iterator>(last), value);
+        return first + (found - first);
+    }
+
+    template<class BoolRangePair>
+    [[nodiscard]] bool any_of(const _ctg_bool_const_iterator<BoolRangePair> first, const _ctg_bool_const_iterator<BoolRangePair> last) noexcept
+    {
+        return find(first, last, true) != last;
+    }
+
+    template<class BoolRangePair>
+    [[nodiscard]] bool all_of(const _ctg_bool_const_iterator<BoolRangePair> first, const _ctg_bool_const_iterator<BoolRangePair> last) noexcept
+    {
+        return find(first, last, false) == last;
+    }
+
+    template<class BoolRangePair>
+    [[nodiscard]] bool none_of(const _ctg_bool_const_iterator<BoolRangePair> first, const _ctg_bool_const_iterator<BoolRangePair> last) noexcept
+    {
+        return !any_of(first, last);
+    }
+
+
+    //////////////////////////////////////MODIFIERS///////////////////////////////////////////////////////////////////////////////
+
+
+    template<class BoolRangePair>
+    void fill(const _ctg_bool_iterator<BoolRangePair> first, const _ctg_bool_iterator<BoolRangePair> last, const bool value) noexcept
+    {
+        size_t size = static_cast<size_t>(last - first);
+        if (size == 0)
+            return;
+
+        uint8_t*     bytes  = first._bit_ptr();
+        const size_t offset = first._bit_offset();
+        const uint64_t word = value ? ~uint64_t(0) : 0;
+
+        //Fill up to the first byte boundary, then whole bytes, then the trailing bits.
+        const size_t head_count = std::min(size, (8 - offset) & 7);
+        if (head_count != 0) {
+            _store_bits(bytes++, offset, head_count, word);
+            size -= head_count;
+        }
+
+        std::memset(bytes, value ? 0xFF : 0, size >> 3);
+        if (size & 7)
+            _store_bits(bytes + (size >> 3), 0, size & 7, word);
+    }
+
+    //Note: As with std::copy, output must not lie within [first, last).
+    template<class InBoolRangePair, class OutBoolRangePair>
+    _ctg_bool_iterator<OutBoolRangePair> copy(
+        const _ctg_bool_const_iterator<InBoolRangePair> first,
+        const _ctg_bool_const_iterator<InBoolRangePair> last,
+        const _ctg_bool_iterator<OutBoolRangePair>      output) noexcept
+    {
+        const auto size = last - first;
+
+        _transform_words(output, static_cast<size_t>(size), [&](const size_t index, const size_t bit_count) {
+            return _load_word_at(first, index, bit_count);
+        });
+
+        return output + size;
+    }
+
+    //Note: Required for non-const input, as expu::copy would otherwise be the better match.
+    template<class InBoolRangePair, class OutBoolRangePair>
+    _ctg_bool_iterator<OutBoolRangePair> copy(
+        const _ctg_bool_iterator<InBoolRangePair> first,
+        const _ctg_bool_iterator<InBoolRangePair> last,
+        const _ctg_bool_iterator<OutBoolRangePair> output) noexcept
+    {
+        using const_iterator = _ctg_bool_const_iterator<InBoolRangePair>;
+
+        return copy(static_cast<const_iterator>(first), static_cast<const_iterator>(last), output);
+    }
+
+
+    //////////////////////////////////////BITWISE OPERATIONS///////////////////////////////////////////////////////////////////////////////
+
+
+    template<class LhsBoolRangePair, class RhsBoolRangePair, class OutBoolRangePair, class WordOp>
+    _ctg_bool_iterator<OutBoolRangePair> _bitwise_binary_op(
+        const _ctg_bool_const_iterator<LhsBoolRangePair> first1,
+        const _ctg_bool_const_iterator<LhsBoolRangePair> last1,
+        const _ctg_bool_const_iterator<RhsBoolRangePair> first2,
+        const _ctg_bool_iterator<OutBoolRangePair>       output,
+        WordOp word_op) noexcept
+    {
+        const auto size = last1 - first1;
+
+        _transform_words(output, static_cast<size_t>(size), [&](const size_t index, const size_t bit_count) {
+            return word_op(_load_word_at(first1, index, bit_count), _load_word_at(first2, index, bit_count));
+        });
+
+        return output + size;
+    }
+
+    //Writes the bitwise and of [first1, last1) and [first2, first2 + (last1 - first1)) to output.
+    //Note: output may equal first1 or first2, but must not otherwise overlap either input.
+    template<class LhsBoolRangePair, class RhsBoolRangePair, class OutBoolRangePair>
+    _ctg_bool_iterator<OutBoolRangePair> bitwise_and(
+        const _ctg_bool_const_iterator<LhsBoolRangePair> first1,
+        const _ctg_bool_const_iterator<LhsBoolRangePair> last1,
+        const _ctg_bool_const_iterator<RhsBoolRangePair> first2,
+        const _ctg_bool_iterator<OutBoolRangePair>       output) noexcept
+    {
+        return _bitwise_binary_op(first1, last1, first2, output, [](const uint64_t lhs, const uint64_t rhs) { return lhs & rhs; });
+    }
+
+    //Writes the bitwise or of [first1, last1) and [first2, first2 + (last1 - first1)) to output.
+    template<class LhsBoolRangePair, class RhsBoolRangePair, class OutBoolRangePair>
+    _ctg_bool_iterator<OutBoolRangePair> bitwise_or(
+        const _ctg_bool_const_iterator<LhsBoolRangePair> first1,
+        const _ctg_bool_const_iterator<LhsBoolRangePair> last1,
+        const _ctg_bool_const_iterator<RhsBoolRangePair> first2,
+        const _ctg_bool_iterator<OutBoolRangePair>       output) noexcept
+    {
+        return _bitwise_binary_op(first1, last1, first2, output, [](const uint64_t lhs, const uint64_t rhs) { return lhs | rhs; });
+    }
+
+    //Writes the bitwise xor of [first1, last1) and [first2, first2 + (last1 - first1)) to output.
+    template<class LhsBoolRangePair, class RhsBoolRangePair, class OutBoolRangePair>
+    _ctg_bool_iterator<OutBoolRangePair> bitwise_xor(
+        const _ctg_bool_const_iterator<LhsBoolRangePair> first1,
+        const _ctg_bool_const_iterator<LhsBoolRangePair> last1,
+        const _ctg_bool_const_iterator<RhsBoolRangePair> first2,
+        const _ctg_bool_iterator<OutBoolRangePair>       output) noexcept
+    {
+        return _bitwise_binary_op(first1, last1, first2, output, [](const uint64_t lhs, const uint64_t rhs) { return lhs ^ rhs; });
+    }
+
+    //Writes the bitwise not of [first, last) to output. output may equal first.
+    template<class InBoolRangePair, class OutBoolRangePair>
+    _ctg_bool_iterator<OutBoolRangePair> bitwise_not(
+        const _ctg_bool_const_iterator<InBoolRangePair> first,
+        const _ctg_bool_const_iterator<InBoolRangePair> last,
+        const _ctg_bool_iterator<OutBoolRangePair>      output) noexcept
+    {
+        const auto size = last - first;
+
+        _transform_words(output, static_cast<size_t>(size), [&](const size_t index, const size_t bit_count) {
+            return ~_load_word_at(first, index, bit_count);
+        });
+
+        return output + size;
+    }
+}
+
+#endif // !EXPU_CONTAINERS_BIT_ALGORITHMS_HPP_INCLUDED
@@ -0,0 +1,428 @@
+#ifndef EXPU_CONTAINERS_BIT_DARRAY_HPP_INCLUDED
+#define EXPU_CONTAINERS_BIT_DARRAY_HPP_INCLUDED
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "expu/containers/contiguous_container.hpp"
+#include "expu/containers/bit_algorithms.hpp"
+#include "expu/containers/growth_policies.hpp"
+
+#include "expu/debug.hpp"
+#include "expu/mem_utils.hpp"
+
+namespace expu {
+
+    template<class SizeType, class Pointer, class ConstPointer>
+    struct _bit_darray_data
+    {
+    public:
+        using pointer = Pointer;
+        using const_pointer = ConstPointer;
+
+    public:
+        _bit_darray_data() = default;
+
+        _bit_darray_data(_bit_darray_data&& other) noexcept :
+            first   (std::exchange(other.first, nullptr)),
+            size    (std::exchange(other.size, 0)),
+            capacity(std::exchange(other.capacity, 0)) {}
+
+        constexpr void steal(_bit_darray_data&& other) noexcept
+        {
+            first    = std::exchange(other.first, nullptr);
+            size     = std::exchange(other.size, 0);
+            capacity = std::exchange(other.capacity, 0);
+        }
+
+    public:
+        Pointer  first    = nullptr;
+        SizeType size     = 0; //In bits
+        SizeType capacity = 0; //In words
+    };
+
+    //Growable array of bools, packed into 64 bit words using the same bit layout and iterators as fixed_array<bool>.
+    //Note: Bits past size() within the allocated words are always zero, hence words may be consumed directly.
+    template<class Alloc = std::allocator<uint64_t>, class GrowthPolicy = default_growth>
+    class bit_darray
+    {
+    private:
+        using _alloc_traits = std::allocator_traits<Alloc>;
+        static_assert(std::is_same_v<uint64_t, typename _alloc_traits::value_type>, "expu::bit_darray allocates uint64_t words.");
+
+    public: //Essential typedefs (Container requirements)
+        using allocator_type  = Alloc;
+        using value_type      = bool;
+        using word_type       = uint64_t;
+
+        using pointer         = typename _alloc_traits::pointer;
+        using const_pointer   = typename _alloc_traits::const_pointer;
+        using difference_type = typename _alloc_traits::difference_type;
+        using size_type       = typename _alloc_traits::size_type;
+
+    private:
+        using _data_type = _bit_darray_data<size_type, pointer, const_pointer>;
+
+    public:
+        using reference       = _bool_index;
+        using const_reference = _const_bool_index;
+
+        using iterator       = _ctg_bool_iterator<_data_type>;
+        using const_iterator = _ctg_bool_const_iterator<_data_type>;
+
+        static constexpr size_type bits_per_word = 64;
+
+    public:
+        constexpr bit_darray() noexcept(std::is_nothrow_default_constructible_v<Alloc>) :
+            _cpair(zero_then_variadic{}) {}
+
+        constexpr explicit bit_darray(const Alloc& alloc) noexcept :
+            _cpair(one_then_variadic{}, alloc) {}
+
+        constexpr bit_darray(const size_type n, const bool value, const Alloc& alloc = Alloc()) :
+            bit_darray(alloc)
+        {
+            _reallocate_exactly(_words_for(n));
+            _data().size = n;
+
+            if (value)
+                fill(begin(), end(), true);
+        }
+
+        template<std::forward_iterator FwdIt, std::sentinel_for<FwdIt> Sentinel>
+        constexpr bit_darray(FwdIt first, const Sentinel last, const Alloc& alloc = Alloc()) :
+            bit_darray(alloc)
+        {
+            const auto range_size = static_cast<size_type>(std::ranges::distance(first, last));
+
+            _reallocate_exactly(_words_for(range_size));
+            set_bits(_bytes(), first, last);
+            _data().size = range_size;
+        }
+
+        constexpr bit_darray(const bit_darray& other, const Alloc& alloc) :
+            bit_darray(alloc)
+        {
+            _assign_words(other);
+        }
+
+        constexpr bit_darray(const bit_darray& other) :
+            bit_darray(other, _alloc_traits::select_on_container_copy_construction(other._alloc())) {}
+
+        constexpr bit_darray(bit_darray&& other) noexcept :
+            _cpair(one_then_variadic{}, std::move(other._alloc()), std::move(other._data())) {}
+
+        constexpr ~bit_darray() noexcept
+        {
+            _clear_dealloc();
+        }
+
+    public:
+        constexpr bit_darray& operator=(const bit_darray& other)
+        {
+            if (this == &other)
+                return *this;
+
+            if constexpr (_alloc_traits::propagate_on_container_copy_assignment::value) {
+                //Note: Existing words cannot be deallocated by other's allocator.
+                if constexpr (!_alloc_traits::is_always_equal::value) {
+                    if (_alloc() != other._alloc())
+                        _clear_dealloc();
+                }
+
+                _alloc() = other._alloc();
+            }
+
+            _assign_words(other);
+            return *this;
+        }
+
+        constexpr bit_darray& operator=(bit_darray&& other)
+            noexcept(_alloc_traits::propagate_on_container_move_assignment::value || _alloc_traits::is_always_equal::value)
+        {
+            if constexpr (!_alloc_traits::propagate_on_container_move_assignment::value) {
+                if constexpr (!_alloc_traits::is_always_equal::value) {
+                    //On allocators compare false: Copy words, other's words cannot be deallocated using alloc
+                    if (_alloc() != other._alloc()) {
+                        _assign_words(other);
+                        return *this;
+                    }
+                }
+
+                _clear_dealloc();
+            }
+            else {
+                _clear_dealloc();
+                _alloc() = std::move(other._alloc());
+            }
+
+            _data().steal(std::move(other._data()));
+            return *this;
+        }
+
+    private: //Allocation helper functions
+        [[nodiscard]] static constexpr size_type _words_for(const size_type bit_count) noexcept
+        {
+            return right_shift_round_up(bit_count, 6);
+        }
+
+        constexpr void _clear_dealloc() noexcept
+        {
+            if (_data().first) {
+                destroy_range(_alloc(), _data().first, _data().first + _data().capacity);
+                _alloc_traits::deallocate(_alloc(), _data().first, _data().capacity);
+
+                _data().first    = nullptr;
+                _data().size     = 0;
+                _data().capacity = 0;
+            }
+        }
+
+        //Moves to a buffer of exactly new_capacity words, which must hold every word in use. Words past those in
+        //use are zeroed.
+        constexpr void _reallocate_exactly(const size_type new_capacity)
+        {
+            if (new_capacity == _data().capacity)
+                return;
+
+            const pointer new_first = new_capacity != 0 ? _alloc_traits::allocate(_alloc(), new_capacity) : nullptr;
+
+            //Note: Words are trivial, hence neither copying nor filling them can throw.
+            const size_type used_words = word_count();
+            if (used_words != 0)
+                uninitialised_copy(_alloc(), _data().first, _data().first + used_words, std::to_address(new_first));
+
+            if (new_capacity != used_words)
+                uninitialised_fill_n(_alloc(), std::to_address(new_first) + used_words, new_capacity - used_words, word_type(0));
+
+            const size_type old_size = _data().size;
+            _clear_dealloc();
+
+            _data().first    = new_first;
+            _data().size     = old_size;
+            _data().capacity = new_capacity;
+        }
+
+        [[nodiscard]] constexpr size_type _calculate_growth(const size_type min_capacity) const
+        {
+            const size_type max_words = _alloc_traits::max_size(_alloc());
+
+            if (max_words < min_capacity)
+                throw std::length_error("expu::bit_darray too long!");
+
+            const size_type new_capacity = GrowthPolicy::next_capacity(_data().capacity, min_capacity, max_words, sizeof(word_type));
+            return std::clamp(new_capacity, min_capacity, max_words);
+        }
+
+        //Ensures room for extra_bits more bits, growing geometrically
+        constexpr void _reserve_extra(const size_type extra_bits)
+        {
+            const size_type required_words = _words_for(_data().size + extra_bits);
+
+            if (_data().capacity < required_words)
+                _reallocate_exactly(_calculate_growth(required_words));
+        }
+
+        //Overwrites contents with other's, reallocating only if there is insufficient capacity.
+        constexpr void _assign_words(const bit_darray& other)
+        {
+            const size_type other_words = other.word_count();
+            const size_type old_words   = word_count();
+
+            if (_data().capacity < other_words) {
+                _clear_dealloc();
+                _reallocate_exactly(other_words);
+            }
+
+            const auto bytes = _bytes();
+            if (other_words != 0)
+                std::memcpy(bytes, other._bytes(), other_words * sizeof(word_type));
+
+            //Note: Maintains zeroed bits past size()
+            if (other_words < old_words)
+                std::memset(bytes + other_words * sizeof(word_type), 0, (old_words - other_words) * sizeof(word_type));
+
+            _data().size = other._data().size;
+        }
+
+    public:
+        constexpr void reserve(const size_type new_capacity)
+        {
+            const size_type new_words = _words_for(new_capacity);
+
+            if (_data().capacity < new_words) {
+                if (_alloc_traits::max_size(_alloc()) < new_words)
+                    throw std::length_error("expu::bit_darray too long!");
+
+                _reallocate_exactly(new_words);
+            }
+        }
+
+        constexpr void shrink_to_fit()
+        {
+            if (word_count() == 0)
+                _clear_dealloc();
+            else
+                _reallocate_exactly(word_count());
+        }
+
+        constexpr void clear() noexcept
+        {
+            if (_data().size != 0)
+                std::memset(_bytes(), 0, word_count() * sizeof(word_type));
+
+            _data().size = 0;
+        }
+
+    public: //Modifiers
+        constexpr void push_back(const bool value)
+        {
+            if (_data().size == capacity())
+                _reserve_extra(1);
+
+            const size_type index = _data().size++;
+            _bytes()[index >> 3] |= static_cast<uint8_t>(static_cast<uint8_t>(value) << (index & 7));
+        }
+
+        constexpr void pop_back() noexcept
+        {
+            EXPU_VERIFY_DEBUG(!empty(), "expu::bit_darray is empty, cannot pop_back!");
+
+            const size_type index = --_data().size;
+            _bytes()[index >> 3] &= static_cast<uint8_t>(~(1u << (index & 7)));
+        }
+
+        //Appends the low bit_count bits of word, least significant bit first.
+        constexpr void append_bits(const word_type word, const size_type bit_count)
+        {
+            EXPU_VERIFY_DEBUG(bit_count <= bits_per_word, "expu::bit_darray can append at most 64 bits at once!");
+
+            if (bit_count == 0)
+                return;
+
+            _reserve_extra(bit_count);
+
+            const size_type index = _data().size;
+            _store_bits(_bytes() + (index >> 3), index & 7, bit_count, word);
+            _data().size += bit_count;
+        }
+
+        constexpr void resize(const size_type new_size, const bool value = false)
+        {
+            const size_type old_size = _data().size;
+
+            if (new_size < old_size) {
+                //Note: Maintains zeroed bits past size()
+                fill(begin() + static_cast<difference_type>(new_size), end(), false);
+                _data().size = new_size;
+            }
+            else if (old_size < new_size) {
+                _reserve_extra(new_size - old_size);
+                _data().size = new_size;
+
+                if (value)
+                    fill(begin() + static_cast<difference_type>(old_size), end(), true);
+            }
+        }
+
+    private:
+        [[nodiscard]] constexpr uint8_t* _bytes() const noexcept
+        {
+            return reinterpret_cast<uint8_t*>(std::to_address(_data().first));
+        }
+
+        constexpr reference _index_operator(const size_type index) const noexcept
+        {
+            EXPU_L1_ITER_VERIFY(index < size(), "expu::bit_darray index out of bounds!");
+
+            return _bool_index(_bytes() + (index >> 3), static_cast<uint8_t>(index & 7));
+        }
+
+    public: //Element access
+        [[nodiscard]] constexpr const_reference operator[](const size_type index) const noexcept { return _index_operator(index); }
+        [[nodiscard]] constexpr reference       operator[](const size_type index)       noexcept { return _index_operator(index); }
+
+        [[nodiscard]] constexpr const_reference at(const size_type index) const
+        {
+            //Note: safe to do, non-const version of expu::bit_darray::at is inheritely const
+            return static_cast<const_reference>(const_cast<bit_darray&>(*this).at(index));
+        }
+        [[nodiscard]] constexpr reference at(const size_type index)
+        {
+            if (index < size())
+                return _index_operator(index);
+            else
+                throw std::out_of_range("expu::bit_darray index out of bounds!");
+        }
+
+    public: //Word access
+        //Number of words holding at least one bit of the array
+        [[nodiscard]] constexpr size_type word_count() const noexcept { return _words_for(_data().size); }
+
+        //Returns the word holding bits [index * 64, index * 64 + 64), least significant bit first.
+        [[nodiscard]] word_type word(const size_type index) const noexcept
+        {
+            EXPU_L1_ITER_VERIFY(index < word_count(), "expu::bit_darray word index out of bounds!");
+
+            return _load_word(_bytes() + index * sizeof(word_type), sizeof(word_type));
+        }
+
+        //Note: On little endian targets, bit i is bit (i % 64) of words()[i / 64]. Writes must keep bits past
+        //size() zero.
+        [[nodiscard]] constexpr const word_type* words() const noexcept { return std::to_address(_data().first); }
+        [[nodiscard]] constexpr       word_type* words()       noexcept { return std::to_address(_data().first); }
+
+    public: //Range getters
+        [[nodiscard]] constexpr iterator begin()              noexcept { return iterator(_data().first, &_data()); }
+        [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return const_iterator(_data().first, &_data()); }
+        [[nodiscard]] constexpr const_iterator begin()  const noexcept { return cbegin(); }
+
+        [[nodiscard]] constexpr iterator end()              noexcept { return begin() + static_cast<difference_type>(_data().size); }
+        [[nodiscard]] constexpr const_iterator cend() const noexcept { return cbegin() + static_cast<difference_type>(_data().size); }
+        [[nodiscard]] constexpr const_iterator end()  const noexcept { return cend(); }
+
+    public:
+        [[nodiscard]] constexpr size_type size()     const noexcept { return _data().size; }
+        [[nodiscard]] constexpr size_type capacity() const noexcept { return _data().capacity * bits_per_word; }
+        [[nodiscard]] constexpr bool      empty()    const noexcept { return _data().size == 0; }
+
+        [[nodiscard]] constexpr allocator_type get_allocator() const noexcept { return _alloc(); }
+
+    public:
+        [[nodiscard]] friend bool operator==(const bit_darray& lhs, const bit_darray& rhs) noexcept
+        {
+            //Note: Bits past size() are zero, hence whole words may be compared.
+            return lhs.size() == rhs.size() &&
+                (lhs.empty() || std::memcmp(lhs._bytes(), rhs._bytes(), lhs.word_count() * sizeof(word_type)) == 0);
+        }
+
+    private: //private member getters
+        constexpr const allocator_type& _alloc() const noexcept
+        {
+            return _cpair.first();
+        }
+        constexpr auto& _alloc() noexcept
+        {
+            return const_cast<allocator_type&>(static_cast<const bit_darray*>(this)->_alloc());
+        }
+
+        constexpr const _data_type& _data() const noexcept
+        {
+            return _cpair.second();
+        }
+        constexpr auto& _data() noexcept
+        {
+            return const_cast<_data_type&>(static_cast<const bit_darray*>(this)->_data());
+        }
+
+    private:
+        compressed_pair<allocator_type, _data_type> _cpair;
+    };
+}
+
+#endif // !EXPU_CONTAINERS_BIT_DARRAY_HPP_INCLUDED
@@ -1,6 +1,7 @@
 #ifndef CONTIGUOUS_CONTAINER_HPP_INCLUDED
 #define CONTIGUOUS_CONTAINER_HPP_INCLUDED
 
+#include <bit>
 #include <iterator>
 #include <type_traits>
 
@@ -394,17 +395,16 @@ namespace expu {
 
         constexpr _ctg_bool_const_iterator& operator+=(const difference_type n) noexcept
         {
+            //Note: n >> 3 rounds towards negative infinity, hence n & 7 is always a forward step within [0, 8).
             _index._ptr += (n >> 3);
 
             uint16_t mask_prod = static_cast<uint16_t>(_index._mask) << (n & 7);
 
-            if (mask_prod < 0x100) {
+            if (mask_prod < 0x100)
                 _index._mask = mask_prod & 0xFF;
-                if (n < 0) --_index._ptr;
-            }
             else {
                 _index._mask = mask_prod >> 8;
-                if (0 < n) ++_index._ptr;
+                ++_index._ptr;
             }
 
             return *this;
@@ -429,6 +429,10 @@ namespace expu {
         constexpr auto _index_ptr()  const noexcept { return _index._ptr; }
         constexpr auto _index_mask() const noexcept { return _index._mask; }
 
+    public: //Bit position, used by word at a time algorithms
+        [[nodiscard]] constexpr uint8_t* _bit_ptr()    const noexcept { return _index._ptr; }
+        [[nodiscard]] constexpr size_t   _bit_offset() const noexcept { return static_cast<size_t>(std::countr_zero(_index._mask)); }
+
     public:
         [[nodiscard]] friend constexpr difference_type operator-(const _ctg_bool_const_iterator& lhs, const _ctg_bool_const_iterator& rhs)
             noexcept
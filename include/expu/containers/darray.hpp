@@ -1,11 +1,16 @@
 #ifndef EXPU_CONTAINERS_DARRAY_HPP_INCLUDED
 #define EXPU_CONTAINERS_DARRAY_HPP_INCLUDED
 
+#include <algorithm>
 #include <iterator>
 #include <memory>
+#include <ranges>
+#include <span>
 #include <stdexcept>
+#include <utility>
 
 #include "expu/containers/contiguous_container.hpp"
+#include "expu/containers/growth_policies.hpp"
 
 #include "expu/debug.hpp"
 #include "expu/meta/meta_utils.hpp"
@@ -34,10 +39,37 @@ namespace expu {
         }
     };
 
+    //Uninitialised storage for the elements a darray holds inline, before spilling to allocated memory.
+    template<class Type, size_t Capacity>
+    struct _darray_inline_buffer
+    {
+    public:
+        constexpr _darray_inline_buffer() noexcept {}
+        constexpr ~_darray_inline_buffer() noexcept {}
+
+        //Note: Owning container is responsible for (re)constructing elements, hence copying is a no-op.
+        constexpr _darray_inline_buffer(const _darray_inline_buffer&) noexcept {}
+        constexpr _darray_inline_buffer& operator=(const _darray_inline_buffer&) noexcept { return *this; }
+
+    public:
+        [[nodiscard]] constexpr       Type* _inline_first()       noexcept { return _elements; }
+        [[nodiscard]] constexpr const Type* _inline_first() const noexcept { return _elements; }
+
+    private:
+        union { Type _elements[Capacity]; };
+    };
+
+    template<class Type>
+    struct _darray_inline_buffer<Type, 0> {};
+
+    //Implementation shared by darray and small_darray. InlineCapacity elements are stored within the object itself,
+    //only once exceeded is memory requested from the allocator.
     template<
         class Type,
-        class Alloc = std::allocator<Type>>
-    class darray
+        class Alloc,
+        class GrowthPolicy,
+        size_t InlineCapacity>
+    class _basic_darray : private _darray_inline_buffer<Type, InlineCapacity>
     {
     private:
         using _alloc_traits = std::allocator_traits<Alloc>;
@@ -55,10 +87,34 @@ namespace expu {
         using const_pointer   = typename _alloc_traits::const_pointer;
         using difference_type = typename _alloc_traits::difference_type;
         using size_type       = typename _alloc_traits::size_type;
+        using growth_policy   = GrowthPolicy;
 
     private:
         using _data_t = _darray_data<pointer, const_pointer>;
 
+        static constexpr bool _has_inline_buffer = InlineCapacity != 0;
+
+        //Inline elements are addressed directly, hence fancy pointers are not supported.
+        static_assert(!_has_inline_buffer || std::is_same_v<pointer, value_type*>);
+
+        static constexpr bool _trivially_relocatable = is_trivially_relocatable_v<value_type>;
+
+        //Whether moving from another array is guaranteed to only exchange pointers (or otherwise cannot throw).
+        static constexpr bool _nothrow_steal =
+            !_has_inline_buffer || std::is_nothrow_move_constructible_v<value_type>;
+
+        //Policy for copying or relocating whole buffers, provided by GrowthPolicy (see parallel_copy_growth)
+        static constexpr auto _copy_policy = [] {
+            if constexpr (requires { GrowthPolicy::copy_policy; })
+                return GrowthPolicy::copy_policy;
+            else
+                return seq;
+        }();
+
+        //Whether Alloc provides a hook that allows growth without individually moving elements
+        static constexpr bool _can_extend =
+            _allocator_can_expand<Alloc> || (_trivially_relocatable && _allocator_can_reallocate<Alloc>);
+
     //Iterator typedefs
     public:
         using iterator       = ctg_iterator<_data_t>;
@@ -66,18 +122,22 @@ namespace expu {
 
     //Special constructors (and destructor)
     public:
-        constexpr darray() noexcept(std::is_nothrow_default_constructible_v<Alloc>):
+        constexpr _basic_darray() noexcept(std::is_nothrow_default_constructible_v<Alloc>):
             _cpair(zero_then_variadic{})
-        {}
+        {
+            _init_inline_buffer();
+        }
 
-        constexpr darray(const Alloc& new_alloc)
+        constexpr _basic_darray(const Alloc& new_alloc)
             //Note: N4868 asserts allocators must be nothrow copy constructible.
             noexcept(std::is_nothrow_default_constructible_v<pointer>):
             _cpair(one_then_variadic{}, new_alloc)
-        {}
+        {
+            _init_inline_buffer();
+        }
 
-        constexpr darray(const darray& other, const Alloc& alloc):
-            darray(alloc)
+        constexpr _basic_darray(const _basic_darray& other, const Alloc& alloc):
+            _basic_darray(alloc)
         {
             _unallocated_assign(
                 other._data().first,
@@ -85,13 +145,13 @@ namespace expu {
                 other.capacity());
         }
 
-        constexpr darray(const darray& other):
-            darray(other, _alloc_traits::select_on_container_copy_construction(other._alloc())) {}
+        constexpr _basic_darray(const _basic_darray& other):
+            _basic_darray(other, _alloc_traits::select_on_container_copy_construction(other._alloc())) {}
 
-        constexpr darray(darray&& other, const Alloc& alloc)
+        constexpr _basic_darray(_basic_darray&& other, const Alloc& alloc)
             noexcept(_alloc_traits::is_always_equal::value &&
-                     std::is_nothrow_copy_constructible_v<Alloc>):
-            darray(alloc)
+                     std::is_nothrow_copy_constructible_v<Alloc> && _nothrow_steal):
+            _basic_darray(alloc)
         {
             if constexpr (!_alloc_traits::is_always_equal::value) {
                 //On allocators compare false: Individually move, others' data
@@ -107,21 +167,23 @@ namespace expu {
             }
 
             //Steal contents
-            _data().steal(std::move(other._data()));
+            _steal(std::move(other));
         }
 
-        constexpr darray(darray&& other)
-            noexcept:
-            _cpair(one_then_variadic{},
-                   std::move(other._alloc()),
-                   std::exchange(other._data().first, nullptr),
-                   std::exchange(other._data().last , nullptr),
-                   std::exchange(other._data().end  , nullptr))
-        {}
+        constexpr _basic_darray(_basic_darray&& other)
+            noexcept(_nothrow_steal):
+            _cpair(one_then_variadic{}, _forward_alloc(other._alloc()))
+        {
+            _init_inline_buffer();
+            _steal(std::move(other));
+        }
 
-        constexpr ~darray() noexcept
+        constexpr ~_basic_darray() noexcept
         {
             _clear_dealloc();
+
+            if constexpr (_has_inline_buffer)
+                allocator_release(_alloc(), this->_inline_first(), InlineCapacity);
         }
 
     public:
@@ -129,8 +191,8 @@ namespace expu {
             std::input_iterator InputIt,
             std::sentinel_for<InputIt> Sentinel>
         requires(!std::forward_iterator<InputIt>)
-        constexpr darray(InputIt first, const Sentinel last, const Alloc& alloc = Alloc()):
-            darray(alloc)
+        constexpr _basic_darray(InputIt first, const Sentinel last, const Alloc& alloc = Alloc()):
+            _basic_darray(alloc)
         {
             for (; first != last; ++first)
                 emplace_back(*first);
@@ -139,8 +201,8 @@ namespace expu {
         template<
             std::forward_iterator FwdIt,
             std::sentinel_for<FwdIt> Sentinel>
-        constexpr darray(const FwdIt first, const Sentinel last, const Alloc& alloc = Alloc()):
-            darray(alloc)
+        constexpr _basic_darray(const FwdIt first, const Sentinel last, const Alloc& alloc = Alloc()):
+            _basic_darray(alloc)
         {
             _unallocated_assign(first, last, std::ranges::distance(first, last));
         }
@@ -151,7 +213,7 @@ namespace expu {
         {
             if (_data().first) {
                 destroy_range(_alloc(), _data().first, _data().last);
-                _alloc_traits::deallocate(_alloc(), _data().first, capacity());
+                _deallocate(_data().first, capacity());
             }
         }
 
@@ -162,7 +224,111 @@ namespace expu {
 
             _data().first = new_first;
             _data().last  = new_last;
-            _data().end   = new_first + new_capacity;
+            _data().end   = _buffer_end(new_first, new_capacity);
+        }
+
+    protected:
+        [[nodiscard]] constexpr bool _is_inline() const noexcept
+        {
+            if constexpr (_has_inline_buffer)
+                return _data().first == this->_inline_first();
+            else
+                return false;
+        }
+
+    private: //Inline buffer helpers
+        //Points the array at its (empty) inline buffer.
+        constexpr void _reset_to_inline_buffer() noexcept
+        {
+            _data().first = _data().last = this->_inline_first();
+            _data().end   = this->_inline_first() + InlineCapacity;
+        }
+
+        //Only to be called once, on construction.
+        constexpr void _init_inline_buffer() noexcept
+        {
+            if constexpr (_has_inline_buffer) {
+                _reset_to_inline_buffer();
+                allocator_adopt(_alloc(), this->_inline_first(), InlineCapacity);
+            }
+        }
+
+        //Returns storage for n elements. The inline buffer is returned whenever it suffices, which relies on
+        //it never being requested whilst already in use (requests are always larger than the current capacity,
+        //except when shrinking allocated memory).
+        [[nodiscard]] constexpr pointer _allocate(const size_type n)
+        {
+            if constexpr (_has_inline_buffer) {
+                if (n <= InlineCapacity)
+                    return this->_inline_first();
+            }
+
+            return _alloc_traits::allocate(_alloc(), n);
+        }
+
+        constexpr void _deallocate(const pointer first, const size_type n) noexcept
+        {
+            if constexpr (_has_inline_buffer) {
+                if (first == this->_inline_first())
+                    return;
+            }
+
+            _alloc_traits::deallocate(_alloc(), first, n);
+        }
+
+        [[nodiscard]] constexpr pointer _buffer_end(const pointer first, const size_type n) noexcept
+        {
+            if constexpr (_has_inline_buffer) {
+                if (first == this->_inline_first())
+                    return this->_inline_first() + InlineCapacity;
+            }
+
+            return first + n;
+        }
+
+        //Note: A moved-from array keeps using its allocator for its inline buffer, hence it is copied instead.
+        [[nodiscard]] static constexpr decltype(auto) _forward_alloc(Alloc& alloc) noexcept
+        {
+            if constexpr (_has_inline_buffer)
+                return std::as_const(alloc);
+            else
+                return std::move(alloc);
+        }
+
+        //Replaces the allocator, ensuring the inline buffer stays adopted by the one in use.
+        template<class OtherAlloc>
+        constexpr void _assign_alloc(OtherAlloc&& other_alloc) noexcept
+        {
+            if constexpr (_has_inline_buffer) {
+                allocator_release(_alloc(), this->_inline_first(), InlineCapacity);
+                _alloc() = std::as_const(other_alloc);
+                allocator_adopt(_alloc(), this->_inline_first(), InlineCapacity);
+            }
+            else
+                _alloc() = std::forward<OtherAlloc>(other_alloc);
+        }
+
+        //Takes ownership of other's memory. Inline elements cannot be stolen, instead they are moved individually
+        //into this' inline buffer, after which other is left empty. Requires this to hold no elements or memory.
+        constexpr void _steal(_basic_darray&& other)
+            noexcept(_nothrow_steal)
+        {
+            if constexpr (_has_inline_buffer) {
+                _reset_to_inline_buffer();
+
+                if (other._is_inline()) {
+                    _data().last = _reversible_uninitialised_move(other._data().first, other._data().last, _data().first);
+
+                    destroy_range(other._alloc(), other._data().first, other._data().last);
+                    other._data().last = other._data().first;
+                }
+                else {
+                    _data() = other._data();
+                    other._reset_to_inline_buffer();
+                }
+            }
+            else
+                _data().steal(std::move(other._data()));
         }
 
     private: //Helper assign functions
@@ -171,7 +337,14 @@ namespace expu {
             std::sentinel_for<InputIt> Sentinel>
         constexpr void _unallocated_assign(const InputIt first, const Sentinel last, const size_type capacity)
         {
-            _data().last = _ctg_duplicate(_alloc(), first, last, _data().first, capacity);
+            if constexpr (_has_inline_buffer) {
+                if (capacity <= InlineCapacity) {
+                    _data().last = uninitialised_copy(_alloc(), first, last, _data().first);
+                    return;
+                }
+            }
+
+            _data().last = _ctg_duplicate(_alloc(), first, last, _data().first, capacity, _copy_policy);
             _data().end  = _data().first + capacity;
         }
 
@@ -196,7 +369,7 @@ namespace expu {
         template<
             std::forward_iterator FwdIt,
             std::sentinel_for<FwdIt> Sentinel>
-        constexpr darray& _alt_alloc_assign(Alloc& alt_alloc, FwdIt first, const Sentinel last)
+        constexpr _basic_darray& _alt_alloc_assign(Alloc& alt_alloc, FwdIt first, const Sentinel last)
         {
             const size_type range_size = static_cast<size_type>(std::ranges::distance(first, last));
 
@@ -225,7 +398,7 @@ namespace expu {
         template<
             std::input_iterator InputIt,
             std::sentinel_for<InputIt> Sentinel>
-        constexpr darray& assign(InputIt first, const Sentinel last)
+        constexpr _basic_darray& assign(InputIt first, const Sentinel last)
         {
             if constexpr(std::forward_iterator<InputIt>) {
                 return _alt_alloc_assign(_alloc(), first, last);
@@ -246,24 +419,24 @@ namespace expu {
             }
         }
 
-        constexpr darray& operator=(const darray& other)
+        constexpr _basic_darray& operator=(const _basic_darray& other)
         {
             if constexpr (_alloc_traits::propagate_on_container_copy_assignment::value) {
                 if constexpr (!_alloc_traits::is_always_equal::value) {
                     if (_alloc() != other._alloc()) {
                         _alt_alloc_assign(other._alloc(), other._data().first, other._data().last);
-                        _alloc() = other._alloc();
+                        _assign_alloc(other._alloc());
                         return *this;
                     }
                 }
 
-                _alloc() = other._alloc();
+                _assign_alloc(other._alloc());
             }
 
-            return assign(other._data().first, other._data().end);
+            return assign(other._data().first, other._data().last);
         }
 
-        constexpr darray& operator=(darray&& other) noexcept
+        constexpr _basic_darray& operator=(_basic_darray&& other) noexcept(_nothrow_steal)
         {
             if constexpr (!_alloc_traits::propagate_on_container_move_assignment::value) {
                 if constexpr (!_alloc_traits::is_always_equal::value) {
@@ -277,21 +450,130 @@ namespace expu {
             }
             else {
                 _clear_dealloc();
-                _alloc() = std::move(other._alloc());
+                _assign_alloc(std::move(other._alloc()));
             }
 
-            _data().steal(std::move(other._data()));
+            _steal(std::move(other));
             return *this;
         }
 
     public:
-        constexpr void erase(const const_iterator first, const const_iterator last)
-            noexcept(std::is_nothrow_destructible_v<value_type>)
+        constexpr iterator erase(const const_iterator at)
+            noexcept(_trivially_relocatable || std::is_nothrow_move_assignable_v<value_type>)
         {
-            auto& naked_first = first._unwrapped();
+            EXPU_VERIFY_DEBUG(at._unwrapped() != _data().last, "Cannot erase the end iterator.");
 
-            destroy_range(_alloc(), naked_first, last._unwrapped());
-            _data().last = naked_first;
+            return erase(at, std::next(at));
+        }
+
+        //Erases [first, last), shifting the elements after it down. For trivially relocatable types
+        //the erased elements are destroyed and the tail moved down with a single memmove.
+        constexpr iterator erase(const const_iterator first, const const_iterator last)
+            noexcept(_trivially_relocatable || std::is_nothrow_move_assignable_v<value_type>)
+        {
+            const pointer naked_first = first._unwrapped();
+            const pointer naked_last  = last._unwrapped();
+
+            if (naked_first != naked_last) {
+                if constexpr (_trivially_relocatable) {
+                    destroy_range(_alloc(), naked_first, naked_last);
+                    _uninitialised_relocate_overlapping(
+                        _alloc(), std::to_address(naked_last), std::to_address(_data().last), std::to_address(naked_first));
+
+                    _data().last -= naked_last - naked_first;
+                }
+                else {
+                    const pointer new_last = expu::move(naked_last, _data().last, naked_first);
+
+                    destroy_range(_alloc(), new_last, _data().last);
+                    _data().last = new_last;
+                }
+            }
+
+            return iterator(naked_first, &_data());
+        }
+
+        //Erases all elements satisfying pred in a single pass, preserving the order of the others.
+        //Returns the number of elements erased. If pred throws, the elements not yet visited are kept.
+        template<class Predicate>
+        constexpr size_type erase_if(Predicate pred)
+        {
+            const pointer last = _data().last;
+
+            pointer read = _data().first;
+            while (read != last && !pred(*read))
+                ++read;
+
+            if (read == last)
+                return 0;
+
+            pointer write = read;
+
+            if constexpr (_trivially_relocatable) {
+                //Each run of kept elements is relocated down as a whole, rather than one element at a time
+                pointer run_first = read;
+
+                try {
+                    while (read != last) {
+                        _alloc_traits::destroy(_alloc(), std::to_address(read));
+                        run_first = ++read;
+
+                        while (read != last && !pred(*read))
+                            ++read;
+
+                        _uninitialised_relocate_overlapping(
+                            _alloc(), std::to_address(run_first), std::to_address(read), std::to_address(write));
+
+                        write += read - run_first;
+                    }
+                }
+                catch (...) {
+                    _uninitialised_relocate_overlapping(
+                        _alloc(), std::to_address(run_first), std::to_address(last), std::to_address(write));
+
+                    _data().last = write + (last - run_first);
+                    throw;
+                }
+            }
+            else {
+                //Note: On throw, the elements from write to read are valid but moved from
+                for (++read; read != last; ++read)
+                    if (!pred(*read))
+                        *write++ = std::move(*read);
+
+                destroy_range(_alloc(), write, last);
+            }
+
+            _data().last = write;
+            return static_cast<size_type>(last - write);
+        }
+
+        //Erases the element at, filling its place with the last element (swap and pop).
+        //Constant time, but does not preserve the order of elements.
+        constexpr iterator erase_unordered(const const_iterator at)
+            noexcept(_trivially_relocatable || std::is_nothrow_move_assignable_v<value_type>)
+        {
+            const pointer naked_at    = at._unwrapped();
+            const pointer before_last = std::prev(_data().last);
+
+            EXPU_VERIFY_DEBUG(naked_at != _data().last, "Cannot erase the end iterator.");
+
+            if (naked_at != before_last) {
+                if constexpr (_trivially_relocatable) {
+                    _alloc_traits::destroy(_alloc(), std::to_address(naked_at));
+                    uninitialised_relocate(_alloc(), std::to_address(before_last), std::to_address(_data().last), std::to_address(naked_at));
+
+                    _data().last = before_last;
+                    return iterator(naked_at, &_data());
+                }
+                else
+                    *naked_at = std::move(*before_last);
+            }
+
+            _alloc_traits::destroy(_alloc(), std::to_address(before_last));
+            _data().last = before_last;
+
+            return iterator(naked_at, &_data());
         }
 
     public:
@@ -322,14 +604,92 @@ namespace expu {
             u_emplace_back(std::move(other));
         }
 
+        //Unchecked bulk append, [first, last) must fit within the unused capacity.
+        //Note: Trivially copyable elements from contiguous ranges are copied with a single memcpy.
+        template<
+            std::input_iterator InputIt,
+            std::sentinel_for<InputIt> Sentinel>
+        constexpr void u_append(InputIt first, const Sentinel last)
+        {
+            //Note: Braced, as the check expands to nothing under NDEBUG
+            if constexpr (std::sized_sentinel_for<Sentinel, InputIt>) {
+                EXPU_VERIFY_DEBUG(last - first <= _data().end - _data().last, "Darray has insufficient remaining capacity!");
+            }
+
+            const value_type* const new_last = uninitialised_copy(_alloc(), std::move(first), last, std::to_address(_data().last));
+            _data().last += new_last - std::to_address(_data().last);
+        }
+
+        //Unchecked bulk append of n copies of value, n must fit within the unused capacity.
+        constexpr void u_append_n(const size_type n, const value_type& value)
+            noexcept(std::is_nothrow_copy_constructible_v<value_type>)
+        {
+            EXPU_VERIFY_DEBUG(n <= static_cast<size_type>(_data().end - _data().last), "Darray has insufficient remaining capacity!");
+
+            uninitialised_fill_n(_alloc(), std::to_address(_data().last), n, value);
+            _data().last += n;
+        }
+
+        //Unused capacity, which may be written to directly then made part of the array via commit. Hence producers
+        //which know their count upfront (e.g. decoders) avoid constructing elements one at a time.
+        //Note: Only available for types whose lifetime may begin by writing their bytes.
+        [[nodiscard]] constexpr std::span<value_type> spare_capacity() noexcept
+            requires(std::is_trivially_default_constructible_v<value_type> && std::is_trivially_copyable_v<value_type>)
+        {
+            return std::span<value_type>(std::to_address(_data().last), std::to_address(_data().end));
+        }
+
+        //Appends the first n elements of spare_capacity(), which must have since been written to.
+        constexpr void commit(const size_type n) noexcept
+            requires(std::is_trivially_default_constructible_v<value_type> && std::is_trivially_copyable_v<value_type>)
+        {
+            EXPU_VERIFY_DEBUG(n <= static_cast<size_type>(_data().end - _data().last), "Cannot commit more than the spare capacity!");
+
+            _mark_initialised_if_checked_allocator(_alloc(), std::to_address(_data().last), std::to_address(_data().last + n), true);
+            _data().last += n;
+        }
+
         template<class ... Args>
         constexpr iterator emplace(const const_iterator at, Args&& ... args)
         {
-            const pointer naked_at = at._unwrapped();
+            pointer naked_at = at._unwrapped();
+
+            //Note: On success, emplacement proceeds as if there was always enough capacity
+            if constexpr (_can_extend) {
+                if (_data().last == _data().end) {
+                    //Note: Extending may move the buffer, invalidating args which refer to its elements. Hence, unless
+                    //they are known to lie outside of it, the element is first constructed out of place.
+                    if constexpr (_trivially_relocatable && _allocator_can_reallocate<Alloc>) {
+                        if (!_is_outside_buffer(args...)) {
+                            value_type value(std::forward<Args>(args)...);
+                            return emplace(at, std::move(value));
+                        }
+                    }
+
+                    const difference_type at_index = naked_at - _data().first;
+
+                    if (_try_extend(_calculate_growth(capacity() + 1)))
+                        naked_at = _data().first + at_index;
+                }
+            }
 
             if (_data().last != _data().end) {
                 if (naked_at == _data().last)
                     u_emplace_back(std::forward<Args>(args)...);
+                //Shifting via relocation cannot throw, hence strong guarantee is always provided
+                else if constexpr (_trivially_relocatable) {
+                    _open_gap(naked_at, 1);
+
+                    try {
+                        _alloc_traits::construct(_alloc(), std::to_address(naked_at), std::forward<Args>(args)...);
+                    }
+                    catch (...) {
+                        _close_gap(naked_at, 1);
+                        throw;
+                    }
+
+                    ++_data().last;
+                }
                 else {
                     const pointer before_last = std::prev(_data().last);
 
@@ -372,7 +732,7 @@ namespace expu {
             else {
                 const size_type new_capacity = _calculate_growth(capacity() + 1);
 
-                const pointer new_first    = _alloc_traits::allocate(_alloc(), new_capacity);
+                const pointer new_first    = _allocate(new_capacity);
                 const pointer construct_at = new_first + (naked_at - _data().first);
                       pointer new_last     = new_first;
 
@@ -382,27 +742,31 @@ namespace expu {
                     _alloc_traits::construct(_alloc(), std::to_address(construct_at), std::forward<Args>(args)...);
                 }
                 catch (...) {
-                    _alloc_traits::deallocate(_alloc(), new_first, new_capacity);
+                    _deallocate(new_first, new_capacity);
                     throw;
                 }
 
-                try {
-                    if (naked_at == _data().last) {
-                        new_last = _reversible_uninitialised_move(_data().first, _data().last, new_first);
-                        ++new_last;
+                if constexpr (_trivially_relocatable)
+                    new_last = _relocate_split(naked_at, new_first, std::next(construct_at));
+                else {
+                    try {
+                        if (naked_at == _data().last) {
+                            new_last = _reversible_uninitialised_move(_data().first, _data().last, new_first);
+                            ++new_last;
+                        }
+                        else {
+                            new_last = _reversible_uninitialised_move(_data().first, naked_at, new_first);
+                            ++new_last;
+                            new_last = _reversible_uninitialised_move(naked_at, _data().last, new_last);
+                        }
+
                     }
-                    else {
-                        new_last = _reversible_uninitialised_move(_data().first, naked_at, new_first);
-                        ++new_last;
-                        new_last = _reversible_uninitialised_move(naked_at, _data().last, new_last);
+                    catch (...) {
+                        destroy_range(_alloc(), new_first, new_last);
+                        _alloc_traits::destroy(_alloc(), std::to_address(construct_at));
+                        _deallocate(new_first, new_capacity);
+                        throw;
                     }
-
-                }
-                catch (...) {
-                    destroy_range(_alloc(), new_first, new_last);
-                    _alloc_traits::destroy(_alloc(), std::to_address(construct_at));
-                    _alloc_traits::deallocate(_alloc(), new_first, new_capacity);
-                    throw;
                 }
 
                 _replace(new_first, new_last, new_capacity);
@@ -441,28 +805,65 @@ namespace expu {
                 return uninitialised_copy(_alloc(), first, last, output);
         }
 
-    public:
+        //Relocates elements into the new buffer, such that those from at onwards are placed starting at new_at.
+        //Afterwards, the old buffer holds no constructed elements. Note: Only viable for trivially relocatable types.
+        constexpr pointer _relocate_split(const pointer at, const pointer new_first, const pointer new_at) noexcept
+        {
+            uninitialised_relocate(_copy_policy, _alloc(), std::to_address(_data().first), std::to_address(at), std::to_address(new_first));
+            const pointer new_last = uninitialised_relocate(_copy_policy, _alloc(), std::to_address(at), std::to_address(_data().last), std::to_address(new_at));
+
+            _data().last = _data().first;
+            return new_last;
+        }
+
+        //Shifts [at, last) forward by n, leaving n uninitialised elements at at. Requires enough unused capacity.
+        constexpr void _open_gap(const pointer at, const size_type n) noexcept
+        {
+            _uninitialised_relocate_overlapping(_alloc(), std::to_address(at), std::to_address(_data().last), std::to_address(at + n));
+        }
+
+        //Reverses _open_gap, assuming all elements of the gap have since been destroyed (or never constructed).
+        constexpr void _close_gap(const pointer at, const size_type n) noexcept
+        {
+            _uninitialised_relocate_overlapping(_alloc(), std::to_address(at + n), std::to_address(_data().last + n), std::to_address(at));
+        }
+
+    private:
+        //Bytes of an input range buffered within the stack before spilling to the heap (see _insert_buffered).
+        static constexpr size_t _input_chunk_bytes = 1024;
+
+        static constexpr size_t _input_chunk_capacity =
+            std::is_same_v<pointer, value_type*> ? std::max<size_t>(1, _input_chunk_bytes / sizeof(value_type)) : 0;
+
+        //An input range's size is only known once consumed. Hence, rather than appending then rotating into place,
+        //elements are first read into a buffer whose first chunk is held inline, then inserted all at once.
         template<
             std::input_iterator InputIt,
             std::sentinel_for<InputIt> Sentinel>
-        requires(!std::forward_iterator<InputIt>)
-        constexpr darray& insert(const const_iterator at, InputIt first, const Sentinel last)
+        constexpr void _insert_buffered(const const_iterator at, InputIt first, const Sentinel last)
         {
-            const size_type at_index  = static_cast<size_type>(at._unwrapped() - _data().first);
-            const size_type prev_size = size();
+            _basic_darray<value_type, Alloc, GrowthPolicy, _input_chunk_capacity> buffer(_alloc());
 
             for (; first != last; ++first)
-                emplace_back(*first);
+                buffer.emplace_back(*first);
+
+            _insert_sized(at, std::make_move_iterator(buffer.begin()), std::make_move_iterator(buffer.end()), buffer.size());
+        }
 
-            //If insertion occurs at end, do not rotate.
-            if (at_index != prev_size) {
-                //Todo: Create bespoke version. Look into adding simd instructions to speed up
-                //for random access iterators
-                std::rotate(
-                    _data().first + at_index,
-                    _data().first + prev_size,
-                    _data().last);
+    public:
+        template<
+            std::input_iterator InputIt,
+            std::sentinel_for<InputIt> Sentinel>
+        requires(!std::forward_iterator<InputIt>)
+        constexpr _basic_darray& insert(const const_iterator at, InputIt first, const Sentinel last)
+        {
+            //If insertion occurs at end, no elements need to be shifted.
+            if (at._unwrapped() == _data().last) {
+                for (; first != last; ++first)
+                    emplace_back(*first);
             }
+            else
+                _insert_buffered(at, std::move(first), last);
 
             return *this;
         }
@@ -472,12 +873,35 @@ namespace expu {
             std::sentinel_for<FwdIt> Sentinel>
         constexpr void insert(const const_iterator at, FwdIt first, const Sentinel last)
         {
-            const auto naked_at = at._unwrapped();
+            const auto range_size = static_cast<size_type>(std::ranges::distance(first, last));
+
+            _insert_sized(at, std::move(first), last, range_size);
+        }
+
+    private:
+        //Inserts the range_size elements of [first, last), reading each only once. Hence any input range
+        //of known size may be inserted with at most one allocation.
+        template<
+            std::input_iterator InputIt,
+            std::sentinel_for<InputIt> Sentinel>
+        constexpr void _insert_sized(const const_iterator at, InputIt first, const Sentinel last, const size_type range_size)
+        {
+            auto naked_at = at._unwrapped();
 
             EXPU_VERIFY_DEBUG((_data().first <= naked_at) && (naked_at <= _data().last),
                 "Insertion at pointer does not lie within constructed range (or one after the end) of the array!");
 
-            const auto range_size      = static_cast<size_type>(std::ranges::distance(first, last));
+            //Note: On success, insertion proceeds as if there was always enough capacity
+            if constexpr (_can_extend) {
+                if (static_cast<size_type>(_data().end - _data().last) < range_size) {
+                    const difference_type at_index = naked_at - _data().first;
+
+                    //Note: Extending may move the buffer, hence only may do so if [first, last) lies outside of it
+                    if (_try_extend(_calculate_growth(size() + range_size), _is_range_outside_buffer(first, range_size)))
+                        naked_at = _data().first + at_index;
+                }
+            }
+
             const auto unused_capacity = static_cast<size_type>(_data().end - _data().last);
 
             //Avoid invalidating iterators
@@ -487,7 +911,7 @@ namespace expu {
                 //Todo: Consider insert function that doesn't grow geometrically
                 const auto new_capacity = _calculate_growth(size() + range_size);
 
-                const pointer new_first = _alloc_traits::allocate(_alloc(), new_capacity);
+                const pointer new_first = _allocate(new_capacity);
                       pointer new_last  = nullptr;
 
                 pointer constructed_last = new_first + (naked_at - _data().first);
@@ -495,23 +919,41 @@ namespace expu {
                     new_last = uninitialised_copy(_alloc(), first, last, constructed_last);
                 }
                 catch (...) {
-                    _alloc_traits::deallocate(_alloc(), new_first, new_capacity);
+                    _deallocate(new_first, new_capacity);
                     throw;
                 }
 
+                if constexpr (_trivially_relocatable)
+                    new_last = _relocate_split(naked_at, new_first, new_last);
+                else {
+                    try {
+                        _reversible_uninitialised_move(_data().first, naked_at, new_first);
+                        constructed_last = new_first;
+                        new_last = _reversible_uninitialised_move(naked_at, _data().last, new_last);
+                    }
+                    catch (...) {
+                        //Destroy partially constructed range
+                        destroy_range(_alloc(), constructed_last, new_last);
+                        _deallocate(new_first, new_capacity);
+                        throw;
+                    }
+                }
+
+                _replace(new_first, new_last, new_capacity);
+            }
+            //Shifting via relocation cannot throw, hence strong guarantee is always provided
+            else if constexpr (_trivially_relocatable) {
+                _open_gap(naked_at, range_size);
+
                 try {
-                    _reversible_uninitialised_move(_data().first, naked_at, new_first);
-                    constructed_last = new_first;
-                    new_last = _reversible_uninitialised_move(naked_at, _data().last, new_last);
+                    uninitialised_copy(_alloc(), first, last, std::to_address(naked_at));
                 }
                 catch (...) {
-                    //Destroy partially constructed range
-                    destroy_range(_alloc(), constructed_last, new_last);
-                    _alloc_traits::deallocate(_alloc(), new_first, new_capacity);
+                    _close_gap(naked_at, range_size);
                     throw;
                 }
 
-                _replace(new_first, new_last, new_capacity);
+                _data().last += range_size;
             }
             //todo: STL does something weird here, they avoid assignment and instead
             //destroy then reconstruct the elements into position. Possible explanation:
@@ -589,30 +1031,117 @@ namespace expu {
             }
         }
 
+    public:
+        //Inserts the elements of range before at. If the size of range is known upfront, at most one allocation is made.
+        template<std::ranges::input_range Range>
+        constexpr iterator insert_range(const const_iterator at, Range&& range)
+        {
+            const difference_type at_index = at._unwrapped() - _data().first;
+
+            if constexpr (std::ranges::sized_range<Range>)
+                _insert_sized(at, std::ranges::begin(range), std::ranges::end(range), static_cast<size_type>(std::ranges::size(range)));
+            else
+                insert(at, std::ranges::begin(range), std::ranges::end(range));
+
+            return iterator(_data().first + at_index, &_data());
+        }
+
+        template<std::ranges::input_range Range>
+        constexpr void append_range(Range&& range)
+        {
+            insert_range(cend(), std::forward<Range>(range));
+        }
+
     private:
+        //Whether args are known not to refer to elements of this array. That is, if there are none, or a single
+        //value_type which is not an element.
+        template<class ... Args>
+        constexpr bool _is_outside_buffer(const Args& ... args) const noexcept
+        {
+            if constexpr (sizeof...(Args) == 0)
+                return true;
+            else if constexpr (sizeof...(Args) == 1 && (std::is_same_v<Args, value_type> && ...)) {
+                const value_type* const arg = std::addressof(args...);
+                return !(std::to_address(_data().first) <= arg && arg < std::to_address(_data().last));
+            }
+            else
+                return false;
+        }
+
+        //Whether the count elements from first are known not to be elements of this array. That is, if the range is
+        //empty, or a contiguous range of value_type which does not overlap the array.
+        template<class InputIt>
+        constexpr bool _is_range_outside_buffer(const InputIt& first, const size_type count) const noexcept
+        {
+            if constexpr (std::contiguous_iterator<InputIt> && std::is_same_v<std::iter_value_t<InputIt>, value_type>) {
+                const value_type* const range_first = std::to_address(first);
+
+                return count == 0 ||
+                    range_first + count <= std::to_address(_data().first) ||
+                    std::to_address(_data().last) <= range_first;
+            }
+            else
+                return count == 0;
+        }
+
+        //Attempts to grow to new_capacity without individually moving elements. That is, either by expanding the
+        //buffer in place or, for trivially relocatable types, by letting the allocator move the buffer bytewise.
+        //Note: The latter invalidates references to elements, hence is only attempted if may_move is set.
+        constexpr bool _try_extend(const size_type new_capacity, const bool may_move = true) noexcept
+        {
+            if (!_data().first || _is_inline())
+                return false;
+
+            if (allocator_try_expand(_alloc(), _data().first, capacity(), new_capacity)) {
+                _data().end = _data().first + new_capacity;
+                return true;
+            }
+
+            if constexpr (_trivially_relocatable) {
+                const pointer new_first = may_move ?
+                    allocator_try_reallocate(_alloc(), _data().first, capacity(), new_capacity) : nullptr;
+
+                if (new_first) {
+                    _data().last  = new_first + size();
+                    _data().first = new_first;
+                    _data().end   = new_first + new_capacity;
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
         constexpr void _unchecked_grow_exactly(const size_type new_capacity)
         {
-            if constexpr (std::is_nothrow_move_constructible_v<value_type>) {
-                const pointer new_first = _alloc_traits::allocate(_alloc(), new_capacity);
+            if constexpr (_can_extend) {
+                if (_try_extend(new_capacity))
+                    return;
+            }
+
+            if constexpr (_trivially_relocatable) {
+                const pointer new_first = _allocate(new_capacity);
+                const pointer new_last  = _relocate_split(_data().last, new_first, new_first + size());
+
+                _replace(new_first, new_last, new_capacity);
+            }
+            else if constexpr (std::is_nothrow_move_constructible_v<value_type>) {
+                const pointer new_first = _allocate(new_capacity);
                 //Note: Below will not throw, hence strong guarantee provided by _resize_assign is redundant
                 const pointer new_last  = uninitialised_move(_alloc(), _data().first, _data().last, std::to_address(new_first));
 
                 _replace(new_first, new_last, new_capacity);
             }
             else
-                _resize_assign(_alloc(), _data().first, _data().end, new_capacity);
+                _resize_assign(_alloc(), _data().first, _data().last, new_capacity);
         }
 
         constexpr size_type _calculate_growth(const size_type min_capacity) {
             if (max_size() < min_capacity)
                 throw std::bad_array_new_length();
 
-            const size_type half_size = size() >> 1;
-
-            if (max_size() - half_size < size())
-                return max_size();
-            else
-                return std::max(min_capacity, size() + half_size);
+            const size_type new_capacity = GrowthPolicy::next_capacity(size(), min_capacity, max_size(), sizeof(value_type));
+            return std::clamp(new_capacity, min_capacity, max_size());
         }
 
         constexpr void _grow_geometric(const size_type min_capacity)
@@ -620,6 +1149,70 @@ namespace expu {
             _unchecked_grow_exactly(_calculate_growth(min_capacity));
         }
 
+        //Reallocates to new_capacity, constructing count elements after the existing ones (via construct(first, count))
+        //before any are moved. Hence, if construction throws, the array is left untouched.
+        template<class Construct>
+        constexpr void _reallocate_append(const size_type new_capacity, const size_type count, Construct&& construct)
+        {
+            const pointer new_first    = _allocate(new_capacity);
+            const pointer append_first = new_first + size();
+            const pointer new_last     = append_first + count;
+
+            try {
+                construct(std::to_address(append_first), count);
+            }
+            catch (...) {
+                _deallocate(new_first, new_capacity);
+                throw;
+            }
+
+            if constexpr (_trivially_relocatable)
+                _relocate_split(_data().last, new_first, append_first);
+            else {
+                try {
+                    _reversible_uninitialised_move(_data().first, _data().last, new_first);
+                }
+                catch (...) {
+                    destroy_range(_alloc(), append_first, new_last);
+                    _deallocate(new_first, new_capacity);
+                    throw;
+                }
+            }
+
+            _replace(new_first, new_last, new_capacity);
+        }
+
+        //Resizes to new_size, constructing new elements via construct(first, count). Provides strong guarantee.
+        template<class Construct>
+        constexpr void _resize_with(const size_type new_size, Construct&& construct)
+        {
+            if (new_size <= size()) {
+                const pointer new_last = _data().first + new_size;
+
+                destroy_range(_alloc(), new_last, _data().last);
+                _data().last = new_last;
+                return;
+            }
+
+            const size_type count = new_size - size();
+
+            if (capacity() < new_size) {
+                const size_type new_capacity = _calculate_growth(new_size);
+
+                bool extended = false;
+                if constexpr (_can_extend)
+                    extended = _try_extend(new_capacity);
+
+                if (!extended) {
+                    _reallocate_append(new_capacity, count, std::forward<Construct>(construct));
+                    return;
+                }
+            }
+
+            construct(std::to_address(_data().last), count);
+            _data().last += count;
+        }
+
     public:
         constexpr void reserve(const size_type size)
         {
@@ -627,23 +1220,63 @@ namespace expu {
                 _unchecked_grow_exactly(size);
         }
 
+        //Resizes to new_size elements, value-initialising those appended.
+        constexpr void resize(const size_type new_size)
+        {
+            _resize_with(new_size, [this](value_type* const first, const size_type count) {
+                uninitialised_value_construct_n(_alloc(), first, count);
+            });
+        }
+
+        //Resizes to new_size elements, copy constructing those appended from value.
+        constexpr void resize(const size_type new_size, const value_type& value)
+        {
+            //Note: Extending may relocate the buffer, invalidating value should it be an element of this array.
+            if constexpr (_can_extend) {
+                if (_data().first <= std::addressof(value) && std::addressof(value) < _data().last) {
+                    const value_type value_copy(value);
+                    resize(new_size, value_copy);
+                    return;
+                }
+            }
+
+            _resize_with(new_size, [this, &value](value_type* const first, const size_type count) {
+                uninitialised_fill_n(_alloc(), first, count, value);
+            });
+        }
+
+        //Resizes to new_size elements, default-initialising those appended. That is, appended elements of
+        //trivially default constructible types are left uninitialised, ready to be overwritten.
+        constexpr void resize_for_overwrite(const size_type new_size)
+        {
+            _resize_with(new_size, [this](value_type* const first, const size_type count) {
+                uninitialised_default_construct_n(_alloc(), first, count);
+            });
+        }
+
         constexpr void shrink_to_fit()
             noexcept(std::is_nothrow_move_constructible_v<value_type> || std::is_nothrow_copy_constructible_v<value_type>)
         {
             //In the case where no shrinking can be done, avoid invalidating iterators
-            if (_data().last != _data().end) {
-                const pointer new_first = _alloc_traits::allocate(_alloc(), size());
+            if (_data().last != _data().end && !_is_inline()) {
+                const size_type new_capacity = size();
+
+                const pointer new_first = _allocate(new_capacity);
                       pointer new_last  = nullptr;
 
-                try {
-                    new_last = _reversible_uninitialised_move(_data().first, _data().last, new_first);
-                }
-                catch (...) {
-                    _alloc_traits::deallocate(new_first, size());
-                    throw;
+                if constexpr (_trivially_relocatable)
+                    new_last = _relocate_split(_data().last, new_first, new_first + new_capacity);
+                else {
+                    try {
+                        new_last = _reversible_uninitialised_move(_data().first, _data().last, new_first);
+                    }
+                    catch (...) {
+                        _deallocate(new_first, new_capacity);
+                        throw;
+                    }
                 }
 
-                _replace(new_first, new_last, size());
+                _replace(new_first, new_last, new_capacity);
             }
         }
 
@@ -657,7 +1290,7 @@ namespace expu {
 
         [[nodiscard]] constexpr reference operator[](const size_type index) noexcept
         {
-            return const_cast<reference>(static_cast<const darray&>(*this).operator[](index));
+            return const_cast<reference>(static_cast<const _basic_darray&>(*this).operator[](index));
         }
 
         [[nodiscard]] constexpr const_reference unchecked_front() const noexcept
@@ -668,7 +1301,7 @@ namespace expu {
 
         [[nodiscard]] constexpr reference unchecked_front() noexcept
         {
-            return const_cast<reference>(static_cast<const darray&>(*this).unchecked_front());
+            return const_cast<reference>(static_cast<const _basic_darray&>(*this).unchecked_front());
         }
 
 
@@ -680,7 +1313,7 @@ namespace expu {
 
         [[nodiscard]] constexpr reference unchecked_back() noexcept
         {
-            return const_cast<reference>(static_cast<const darray&>(*this).unchecked_back());
+            return const_cast<reference>(static_cast<const _basic_darray&>(*this).unchecked_back());
         }
 
         [[nodiscard]] constexpr const_reference front() const
@@ -693,7 +1326,7 @@ namespace expu {
 
         [[nodiscard]] constexpr reference front()
         {
-            return const_cast<reference>(static_cast<const darray&>(*this).front());
+            return const_cast<reference>(static_cast<const _basic_darray&>(*this).front());
         }
 
         [[nodiscard]] constexpr const_reference back() const
@@ -706,7 +1339,7 @@ namespace expu {
 
         [[nodiscard]] constexpr reference back()
         {
-            return const_cast<reference>(static_cast<const darray&>(*this).back());
+            return const_cast<reference>(static_cast<const _basic_darray&>(*this).back());
         }
 
     //Size getters
@@ -756,6 +1389,32 @@ namespace expu {
         compressed_pair<allocator_type, _data_t> _cpair;
     };
 
+    template<
+        class Type,
+        class Alloc        = std::allocator<Type>,
+        class GrowthPolicy = default_growth>
+    class darray : public _basic_darray<Type, Alloc, GrowthPolicy, 0>
+    {
+    private:
+        using _base = _basic_darray<Type, Alloc, GrowthPolicy, 0>;
+
+    public:
+        using _base::_base;
+    };
+
+    //Erasure functions in the manner of std::erase and std::erase_if, returning the number of elements erased.
+    template<class Type, class Alloc, class GrowthPolicy, size_t InlineCapacity, class Predicate>
+    constexpr auto erase_if(_basic_darray<Type, Alloc, GrowthPolicy, InlineCapacity>& arr, Predicate pred)
+    {
+        return arr.erase_if(std::move(pred));
+    }
+
+    template<class Type, class Alloc, class GrowthPolicy, size_t InlineCapacity, class Value>
+    constexpr auto erase(_basic_darray<Type, Alloc, GrowthPolicy, InlineCapacity>& arr, const Value& value)
+    {
+        return arr.erase_if([&value](const Type& element) { return element == value; });
+    }
+
 }
 
 #endif // !EXPU_CONTAINERS_DARRAY_HPP_INCLUDED
\ No newline at end of file
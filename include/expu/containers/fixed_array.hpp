@@ -7,6 +7,7 @@
 #include <type_traits>
 
 #include "expu/containers/contiguous_container.hpp"
+#include "expu/containers/bit_algorithms.hpp"
 
 #include "expu/maths/basic_maths.hpp"
 
@@ -143,9 +144,8 @@ namespace expu
             pointer new_first = _alloc_traits::allocate(_alloc(), alloc_size);
             try {
                 if constexpr (_stores_bool) {
-                    //Cast to char* here to ensure that underlying data of bool is correctly set. Todo: Create fill_n function that supports checked_allocator
-                    auto as_uint8 = reinterpret_cast<uint8_t*>(std::to_address(new_first));
-                    auto new_last = std::fill_n(as_uint8, alloc_size, static_cast<uint8_t>(elem ? 0xFF : 0));
+                    //Note: Each bool stores 8 packed bits, hence every byte is set rather than each bool.
+                    auto new_last = _range_fill(std::to_address(new_first), alloc_size, static_cast<uint8_t>(elem ? 0xFF : 0));
 
                     //Hack: Temporarily added support for checked allocator.
                     _mark_initialised_if_checked_allocator(_alloc(), new_first, new_last, true);
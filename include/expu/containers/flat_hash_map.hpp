@@ -0,0 +1,844 @@
+#ifndef EXPU_CONTAINERS_FLAT_HASH_MAP_HPP_INCLUDED
+#define EXPU_CONTAINERS_FLAT_HASH_MAP_HPP_INCLUDED
+
+#include <bit>         //For access to countr_zero and countl_zero
+#include <cstdint>     //For access to fixed width integer types
+#include <cstring>     //For access to memcpy
+#include <functional>  //For access to hash and equal_to
+#include <iterator>
+#include <memory>
+#include <new>         //For access to launder
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "expu/containers/darray.hpp"
+#include "expu/containers/bit_algorithms.hpp"
+
+#include "expu/maths/basic_maths.hpp"
+
+#include "expu/mem_utils.hpp"
+
+/*
+* Open addressing hash map in the style of SwissTable. Each slot has a control byte, which is either empty, deleted
+* or holds the low 7 bits of the slot's hash (H2). Lookups start at the group of control bytes selected by the
+* remaining hash bits (H1), matching H2 against a whole group at once, only comparing keys on a match.
+*
+* Capacity is always zero or one less than a power of two. Control bytes are followed by a sentinel, marking the
+* end for iteration, then a copy of the first group width - 1 control bytes, such that a group may be loaded from
+* any slot.
+*/
+
+namespace expu {
+
+    //////////////////////////////////////CONTROL BYTES///////////////////////////////////////////////////////////////////////////////
+
+
+    enum _ctrl_byte : int8_t
+    {
+        _ctrl_empty    = -128, //0b10000000
+        _ctrl_deleted  = -2,   //0b11111110
+        _ctrl_sentinel = -1,   //0b11111111
+    };
+
+    [[nodiscard]] constexpr bool _is_full(const int8_t ctrl) noexcept { return ctrl >= 0; }
+
+    [[nodiscard]] constexpr bool _is_empty_or_deleted(const int8_t ctrl) noexcept { return ctrl < _ctrl_sentinel; }
+
+    //Bitmask of the slots within a group, SlotShift being log2 of the bits used by each slot.
+    template<class MaskType, size_t Width, size_t SlotShift>
+    class _group_mask
+    {
+    public:
+        constexpr explicit _group_mask(const MaskType mask) noexcept :
+            _mask(mask) {}
+
+    public:
+        [[nodiscard]] constexpr explicit operator bool() const noexcept { return _mask != 0; }
+
+        [[nodiscard]] constexpr size_t lowest() const noexcept
+        {
+            return static_cast<size_t>(std::countr_zero(_mask)) >> SlotShift;
+        }
+
+        //Number of slots before the lowest set slot
+        [[nodiscard]] constexpr size_t leading_clear() const noexcept { return lowest(); }
+
+        //Number of slots after the highest set slot
+        [[nodiscard]] constexpr size_t trailing_clear() const noexcept
+        {
+            constexpr size_t unused_bits = sizeof(MaskType) * 8 - (Width << SlotShift);
+            return static_cast<size_t>(std::countl_zero(_mask) - unused_bits) >> SlotShift;
+        }
+
+        constexpr void clear_lowest() noexcept { _mask &= (_mask - 1); }
+
+    private:
+        MaskType _mask;
+    };
+
+#if defined(EXPU_HAS_SSE2)
+    class _ctrl_group
+    {
+    public:
+        static constexpr size_t width = 16;
+
+        using mask_type = _group_mask<uint32_t, width, 0>;
+
+    public:
+        explicit _ctrl_group(const int8_t* const ctrl) noexcept :
+            _ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+
+    public:
+        [[nodiscard]] mask_type match(const int8_t h2) const noexcept
+        {
+            return mask_type(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), _ctrl))));
+        }
+
+        [[nodiscard]] mask_type match_empty() const noexcept
+        {
+            return match(_ctrl_empty);
+        }
+
+        [[nodiscard]] mask_type match_empty_or_deleted() const noexcept
+        {
+            return mask_type(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(_ctrl_sentinel), _ctrl))));
+        }
+
+    private:
+        __m128i _ctrl;
+    };
+#else
+    //Portable group, testing 8 control bytes at once within a 64 bit word.
+    class _ctrl_group
+    {
+    public:
+        static constexpr size_t width = 8;
+
+        using mask_type = _group_mask<uint64_t, width, 3>;
+
+    private:
+        static constexpr uint64_t _lsbs = 0x0101010101010101;
+        static constexpr uint64_t _msbs = 0x8080808080808080;
+
+    public:
+        explicit _ctrl_group(const int8_t* const ctrl) noexcept :
+            _ctrl(_load_word(reinterpret_cast<const uint8_t*>(ctrl), sizeof(uint64_t))) {}
+
+    public:
+        //Note: May report false positives for bytes following a match, which are rejected when comparing keys.
+        [[nodiscard]] mask_type match(const int8_t h2) const noexcept
+        {
+            const uint64_t matched = _ctrl ^ (_lsbs * static_cast<uint8_t>(h2));
+            return mask_type((matched - _lsbs) & ~matched & _msbs);
+        }
+
+        [[nodiscard]] mask_type match_empty() const noexcept
+        {
+            return mask_type(_ctrl & ~(_ctrl << 6) & _msbs);
+        }
+
+        [[nodiscard]] mask_type match_empty_or_deleted() const noexcept
+        {
+            return mask_type(_ctrl & ~(_ctrl << 7) & _msbs);
+        }
+
+    private:
+        uint64_t _ctrl;
+    };
+#endif
+
+    //Control bytes of a table without any slots. Lookups find an empty slot, iteration immediately finds the sentinel.
+    alignas(16) inline constexpr int8_t _empty_ctrl_group[16] = {
+        _ctrl_sentinel, _ctrl_empty, _ctrl_empty, _ctrl_empty, _ctrl_empty, _ctrl_empty, _ctrl_empty, _ctrl_empty,
+        _ctrl_empty,    _ctrl_empty, _ctrl_empty, _ctrl_empty, _ctrl_empty, _ctrl_empty, _ctrl_empty, _ctrl_empty };
+
+
+    //////////////////////////////////////SLOTS AND ITERATORS///////////////////////////////////////////////////////////////////////////////
+
+
+    //Uninitialised storage for a single element, which is only alive while the slot's control byte is full.
+    template<class ValueType>
+    struct _flat_hash_slot
+    {
+    public:
+        [[nodiscard]] ValueType& value() noexcept
+        {
+            return *std::launder(reinterpret_cast<ValueType*>(_storage));
+        }
+
+        [[nodiscard]] const ValueType& value() const noexcept
+        {
+            return *std::launder(reinterpret_cast<const ValueType*>(_storage));
+        }
+
+    private:
+        alignas(ValueType) unsigned char _storage[sizeof(ValueType)];
+    };
+
+    template<class ValueType, class SlotType>
+    class _flat_hash_iterator
+    {
+    public:
+        using iterator_concept  = std::forward_iterator_tag;
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = std::remove_const_t<ValueType>;
+        using reference         = ValueType&;
+        using pointer           = ValueType*;
+        using difference_type   = std::ptrdiff_t;
+
+    public:
+        constexpr _flat_hash_iterator() noexcept :
+            _ctrl(nullptr), _slot(nullptr) {}
+
+        _flat_hash_iterator(const int8_t* const ctrl, SlotType* const slot) noexcept :
+            _ctrl(ctrl), _slot(slot)
+        {
+            _skip_empty_or_deleted();
+        }
+
+        //Conversion from iterator to const_iterator
+        template<class OtherValueType, class OtherSlotType>
+        requires(std::is_convertible_v<OtherSlotType*, SlotType*> && !std::is_same_v<OtherSlotType, SlotType>)
+        constexpr _flat_hash_iterator(const _flat_hash_iterator<OtherValueType, OtherSlotType>& other) noexcept :
+            _ctrl(other._ctrl), _slot(other._slot) {}
+
+    private:
+        template<class, class>
+        friend class _flat_hash_iterator;
+
+        template<class, class, class, class, class, class>
+        friend class flat_hash_map;
+
+        void _skip_empty_or_deleted() noexcept
+        {
+            while (_is_empty_or_deleted(*_ctrl)) {
+                ++_ctrl;
+                ++_slot;
+            }
+        }
+
+    public:
+        [[nodiscard]] reference operator*()  const noexcept { return _slot->value(); }
+        [[nodiscard]] pointer   operator->() const noexcept { return std::addressof(_slot->value()); }
+
+        _flat_hash_iterator& operator++() noexcept
+        {
+            EXPU_VERIFY_DEBUG(_is_full(*_ctrl), "Iterator is at the end of the container.");
+
+            ++_ctrl;
+            ++_slot;
+            _skip_empty_or_deleted();
+
+            return *this;
+        }
+
+        _flat_hash_iterator operator++(int) noexcept
+        {
+            const _flat_hash_iterator copy(*this);
+            ++*this;
+            return copy;
+        }
+
+        [[nodiscard]] friend constexpr bool operator==(const _flat_hash_iterator& lhs, const _flat_hash_iterator& rhs) noexcept
+        {
+            return lhs._ctrl == rhs._ctrl;
+        }
+
+    private:
+        const int8_t* _ctrl;
+        SlotType*     _slot;
+    };
+
+
+    //////////////////////////////////////STORAGE POLICIES///////////////////////////////////////////////////////////////////////////////
+
+
+    //Storage policies provide the container backing slots and control bytes, via container<Type, Alloc>. It must
+    //be contiguous, constructible from and expose its allocator (get_allocator), and support resize(n) and
+    //resize(n, value). Should it provide resize_for_overwrite, slots are left uninitialised when allocated.
+    struct darray_storage
+    {
+        template<class Type, class Alloc>
+        using container = darray<Type, Alloc>;
+    };
+
+
+    //////////////////////////////////////FLAT HASH MAP///////////////////////////////////////////////////////////////////////////////
+
+
+    //Note: Much like linear_map's Container, Storage (see darray_storage) customises the underlying containers.
+    template<
+        class KeyType,
+        class MappedType,
+        class Hash     = std::hash<KeyType>,
+        class KeyEqual = std::equal_to<KeyType>,
+        class Alloc    = std::allocator<std::pair<const KeyType, MappedType>>,
+        class Storage  = darray_storage>
+    class flat_hash_map
+    {
+    public: //Typedefs
+        using key_type        = KeyType;
+        using mapped_type     = MappedType;
+        using value_type      = std::pair<const KeyType, MappedType>;
+        using hasher          = Hash;
+        using key_equal       = KeyEqual;
+        using allocator_type  = Alloc;
+        using size_type       = size_t;
+        using difference_type = std::ptrdiff_t;
+
+    private:
+        using _slot_type  = _flat_hash_slot<value_type>;
+        using _slot_alloc = typename std::allocator_traits<Alloc>::template rebind_alloc<_slot_type>;
+        using _ctrl_alloc = typename std::allocator_traits<Alloc>::template rebind_alloc<int8_t>;
+
+        using _slots_type = typename Storage::template container<_slot_type, _slot_alloc>;
+        using _ctrls_type = typename Storage::template container<int8_t, _ctrl_alloc>;
+
+        static constexpr size_t _group_width = _ctrl_group::width;
+        static constexpr size_t _cloned_ctrl = _group_width - 1;
+
+    public:
+        using iterator       = _flat_hash_iterator<value_type, _slot_type>;
+        using const_iterator = _flat_hash_iterator<const value_type, const _slot_type>;
+
+    public: //Constructors
+        flat_hash_map() :
+            flat_hash_map(0) {}
+
+        explicit flat_hash_map(const size_type bucket_count, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(), const Alloc& alloc = Alloc()) :
+            _slots(_slot_alloc(alloc)),
+            _ctrls(_ctrl_alloc(alloc)),
+            _functors(one_then_variadic{}, hash, equal)
+        {
+            if (bucket_count != 0)
+                _resize(_normalise_capacity(bucket_count));
+        }
+
+        template<std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+        flat_hash_map(InputIt first, const Sentinel last, const size_type bucket_count = 0, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual(), const Alloc& alloc = Alloc()) :
+            flat_hash_map(bucket_count, hash, equal, alloc)
+        {
+            insert(first, last);
+        }
+
+        flat_hash_map(std::initializer_list<value_type> values) :
+            flat_hash_map(values.begin(), values.end(), values.size()) {}
+
+        flat_hash_map(const flat_hash_map& other) :
+            _slots(_slot_alloc(other._slots.get_allocator())),
+            _ctrls(_ctrl_alloc(other._ctrls.get_allocator())),
+            _functors(one_then_variadic{}, other._hash(), other._key_eq())
+        {
+            if (other.empty())
+                return;
+
+            _resize(other._capacity);
+
+            //Note: Same capacity and hash function, hence every element keeps its slot.
+            size_type index = 0;
+            try {
+                for (; index < _capacity; ++index)
+                    if (_is_full(other._ctrl()[index]))
+                        std::construct_at(std::addressof(_slot_ptr()[index].value()), other._slot_ptr()[index].value());
+            }
+            catch (...) {
+                while (index--)
+                    if (_is_full(other._ctrl()[index]))
+                        std::destroy_at(std::addressof(_slot_ptr()[index].value()));
+
+                throw;
+            }
+
+            std::memcpy(_ctrl(), other._ctrl(), _capacity + 1 + _cloned_ctrl);
+            _size        = other._size;
+            _growth_left = other._growth_left;
+        }
+
+        flat_hash_map(flat_hash_map&& other) noexcept :
+            _slots(std::move(other._slots)),
+            _ctrls(std::move(other._ctrls)),
+            _capacity   (std::exchange(other._capacity, 0)),
+            _size       (std::exchange(other._size, 0)),
+            _growth_left(std::exchange(other._growth_left, 0)),
+            _functors(one_then_variadic{}, other._hash(), other._key_eq()) {}
+
+        ~flat_hash_map()
+        {
+            _destroy_elements();
+        }
+
+    public: //Assignment
+        flat_hash_map& operator=(const flat_hash_map& other)
+        {
+            if (this != &other) {
+                flat_hash_map copy(other);
+                swap(copy);
+            }
+
+            return *this;
+        }
+
+        flat_hash_map& operator=(flat_hash_map&& other) noexcept
+        {
+            if (this != &other) {
+                flat_hash_map moved(std::move(other));
+                swap(moved);
+            }
+
+            return *this;
+        }
+
+    private: //Capacity helper functions
+        //Rounds up to the nearest valid capacity, that is 2^n - 1 holding at least a group.
+        [[nodiscard]] static constexpr size_type _normalise_capacity(const size_type capacity) noexcept
+        {
+            return std::max(std::bit_ceil(capacity + 1) - 1, _cloned_ctrl);
+        }
+
+        //Maximum number of elements for a given capacity, a load factor of 7/8. At least one slot is always left
+        //empty, so that probing terminates.
+        [[nodiscard]] static constexpr size_type _capacity_to_growth(const size_type capacity) noexcept
+        {
+            return capacity - std::max<size_type>(capacity / 8, 1);
+        }
+
+        //Smallest capacity which can hold size elements
+        [[nodiscard]] static constexpr size_type _growth_to_capacity(const size_type size) noexcept
+        {
+            size_type capacity = _normalise_capacity(size + size / 7);
+            while (_capacity_to_growth(capacity) < size)
+                capacity = capacity * 2 + 1;
+
+            return capacity;
+        }
+
+    private: //Table helper functions
+        [[nodiscard]] int8_t* _ctrl() const noexcept
+        {
+            //Note: The empty group is never written to, as insertion first allocates.
+            return _capacity != 0 ?
+                const_cast<int8_t*>(std::to_address(_ctrls.begin())) :
+                const_cast<int8_t*>(_empty_ctrl_group);
+        }
+
+        [[nodiscard]] _slot_type* _slot_ptr() const noexcept
+        {
+            return _capacity != 0 ? const_cast<_slot_type*>(std::to_address(_slots.begin())) : nullptr;
+        }
+
+        template<class KeyLike>
+        [[nodiscard]] uint64_t _hash_of(const KeyLike& key) const
+        {
+            return _mix_hash(static_cast<uint64_t>(_hash()(key)));
+        }
+
+        [[nodiscard]] static constexpr int8_t _h2(const uint64_t hash) noexcept
+        {
+            return static_cast<int8_t>(hash & 0x7F);
+        }
+
+        //Sets the control byte of index, along with its clone past the sentinel.
+        void _set_ctrl(const size_type index, const int8_t value) noexcept
+        {
+            int8_t* const ctrl = _ctrl();
+
+            ctrl[index] = value;
+            ctrl[((index - _cloned_ctrl) & _capacity) + (_cloned_ctrl & _capacity)] = value;
+        }
+
+        //Returns the index holding key, or _capacity if absent.
+        template<class KeyLike>
+        [[nodiscard]] size_type _find_index(const KeyLike& key, const uint64_t hash) const
+        {
+            const int8_t* const     ctrl  = _ctrl();
+            const _slot_type* const slots = _slot_ptr();
+            const int8_t h2 = _h2(hash);
+
+            //Note: Triangular probing over groups visits every group once, as capacity + 1 is a power of two.
+            size_type position = static_cast<size_type>(hash >> 7) & _capacity;
+            for (size_type step = _group_width; ; step += _group_width) {
+                const _ctrl_group group(ctrl + position);
+
+                for (auto matches = group.match(h2); matches; matches.clear_lowest()) {
+                    const size_type index = (position + matches.lowest()) & _capacity;
+
+                    if (_key_eq()(slots[index].value().first, key))
+                        return index;
+                }
+
+                if (group.match_empty())
+                    return _capacity;
+
+                position = (position + step) & _capacity;
+            }
+        }
+
+        //Returns the first empty or deleted index within the probe sequence of hash.
+        [[nodiscard]] size_type _find_first_non_full(const uint64_t hash) const noexcept
+        {
+            const int8_t* const ctrl = _ctrl();
+
+            size_type position = static_cast<size_type>(hash >> 7) & _capacity;
+            for (size_type step = _group_width; ; step += _group_width) {
+                const auto available = _ctrl_group(ctrl + position).match_empty_or_deleted();
+
+                if (available)
+                    return (position + available.lowest()) & _capacity;
+
+                position = (position + step) & _capacity;
+            }
+        }
+
+        //Marks every slot as empty, without destroying elements.
+        void _reset_ctrl() noexcept
+        {
+            int8_t* const ctrl = _ctrl();
+            std::memset(ctrl, static_cast<uint8_t>(_ctrl_empty), _capacity + 1 + _cloned_ctrl);
+            ctrl[_capacity] = _ctrl_sentinel;
+
+            _size        = 0;
+            _growth_left = _capacity_to_growth(_capacity);
+        }
+
+        void _destroy_elements() noexcept
+        {
+            if constexpr (!std::is_trivially_destructible_v<value_type>) {
+                const int8_t* const ctrl  = _ctrl();
+                _slot_type* const   slots = _slot_ptr();
+
+                for (size_type index = 0; index < _capacity; ++index)
+                    if (_is_full(ctrl[index]))
+                        std::destroy_at(std::addressof(slots[index].value()));
+            }
+        }
+
+        //Moves every element into a table of new_capacity slots, which also drops deleted slots. On throw, the
+        //table is left unchanged.
+        void _resize(const size_type new_capacity)
+        {
+            _slots_type new_slots(_slots.get_allocator());
+            _ctrls_type new_ctrls(_ctrls.get_allocator());
+
+            if constexpr (requires { new_slots.resize_for_overwrite(new_capacity); })
+                new_slots.resize_for_overwrite(new_capacity);
+            else
+                new_slots.resize(new_capacity);
+            new_ctrls.resize(new_capacity + 1 + _cloned_ctrl, static_cast<int8_t>(_ctrl_empty));
+            *(new_ctrls.begin() + static_cast<difference_type>(new_capacity)) = _ctrl_sentinel;
+
+            int8_t* const old_ctrl  = _ctrl();
+            _slot_type* const old_slots = _slot_ptr();
+            const size_type old_capacity = _capacity;
+
+            flat_hash_map new_table(std::move(new_slots), std::move(new_ctrls), new_capacity, _hash(), _key_eq());
+
+            //Note: Copies rather than moves elements which may throw when moved, keeping the old table intact.
+            constexpr bool relocate = is_trivially_relocatable_v<value_type>;
+            try {
+                for (size_type index = 0; index < old_capacity; ++index) {
+                    if (_is_full(old_ctrl[index])) {
+                        value_type& value = old_slots[index].value();
+                        const uint64_t hash = _hash_of(value.first);
+                        const size_type new_index = new_table._find_first_non_full(hash);
+                        value_type* const new_value = std::addressof(new_table._slot_ptr()[new_index].value());
+
+                        if constexpr (relocate)
+                            std::memcpy(static_cast<void*>(new_value), std::addressof(value), sizeof(value_type));
+                        else
+                            std::construct_at(new_value, std::move_if_noexcept(value));
+
+                        new_table._set_ctrl(new_index, _h2(hash));
+                        ++new_table._size;
+                    }
+                }
+            }
+            catch (...) {
+                //Note: Relocated elements are still owned by the old table, hence must not be destroyed.
+                if constexpr (relocate)
+                    new_table._reset_ctrl();
+
+                throw;
+            }
+
+            //Note: Relocated elements must not be destroyed by the old table.
+            if constexpr (!relocate)
+                _destroy_elements();
+
+            new_table._growth_left = _capacity_to_growth(new_capacity) - new_table._size;
+
+            _slots       = std::move(new_table._slots);
+            _ctrls       = std::move(new_table._ctrls);
+            _capacity    = std::exchange(new_table._capacity, 0);
+            _growth_left = std::exchange(new_table._growth_left, 0);
+            new_table._size = 0;
+        }
+
+        //Adopts freshly allocated storage, whose control bytes are all empty.
+        flat_hash_map(_slots_type&& slots, _ctrls_type&& ctrls, const size_type capacity, const Hash& hash, const KeyEqual& equal) :
+            _slots(std::move(slots)),
+            _ctrls(std::move(ctrls)),
+            _capacity(capacity),
+            _functors(one_then_variadic{}, hash, equal) {}
+
+        void _rehash_and_grow()
+        {
+            //Note: When mostly deleted slots, rehashing in place reclaims them without growing.
+            if (_capacity > _group_width && _size * 32 <= _capacity * 25)
+                _resize(_capacity);
+            else
+                _resize(_capacity != 0 ? _capacity * 2 + 1 : _cloned_ctrl);
+        }
+
+        //Returns the index holding key, or inserts a slot for it constructed from args.
+        template<class KeyLike, class ... Args>
+        std::pair<iterator, bool> _emplace_unique(const KeyLike& key, Args&& ... args)
+        {
+            const uint64_t hash = _hash_of(key);
+
+            size_type index = _find_index(key, hash);
+            if (index != _capacity)
+                return { _iterator_at(index), false };
+
+            index = _find_first_non_full(hash);
+            if (_growth_left == 0 && _ctrl()[index] != _ctrl_deleted) {
+                _rehash_and_grow();
+                index = _find_first_non_full(hash);
+            }
+
+            //Note: Constructed before marking the slot as full, hence the table is unchanged if construction throws.
+            std::construct_at(std::addressof(_slot_ptr()[index].value()), std::forward<Args>(args)...);
+
+            _growth_left -= (_ctrl()[index] == _ctrl_empty);
+            _set_ctrl(index, _h2(hash));
+            ++_size;
+
+            return { _iterator_at(index), true };
+        }
+
+        [[nodiscard]] iterator _iterator_at(const size_type index) const noexcept
+        {
+            return iterator(_ctrl() + index, _slot_ptr() + index);
+        }
+
+        void _erase_at(const size_type index) noexcept
+        {
+            std::destroy_at(std::addressof(_slot_ptr()[index].value()));
+            --_size;
+
+            //If no group containing index was ever full, no probe sequence can have passed it, hence the slot
+            //may be marked empty rather than deleted.
+            const int8_t* const ctrl = _ctrl();
+            const size_type index_before = (index - _group_width) & _capacity;
+
+            const auto empty_after  = _ctrl_group(ctrl + index).match_empty();
+            const auto empty_before = _ctrl_group(ctrl + index_before).match_empty();
+
+            const bool was_never_full = empty_before && empty_after &&
+                empty_after.leading_clear() + empty_before.trailing_clear() < _group_width;
+
+            _set_ctrl(index, was_never_full ? _ctrl_empty : _ctrl_deleted);
+            _growth_left += was_never_full;
+        }
+
+    public: //Lookup
+        [[nodiscard]] const_iterator find(const key_type& key) const
+        {
+            //Note: Safe to do since find is a const function
+            return const_cast<flat_hash_map&>(*this).find(key);
+        }
+
+        [[nodiscard]] iterator find(const key_type& key)
+        {
+            const size_type index = _find_index(key, _hash_of(key));
+            return index != _capacity ? _iterator_at(index) : end();
+        }
+
+        [[nodiscard]] bool contains(const key_type& key) const
+        {
+            return _find_index(key, _hash_of(key)) != _capacity;
+        }
+
+        [[nodiscard]] size_type count(const key_type& key) const
+        {
+            return contains(key);
+        }
+
+    public: //Indexing functions
+        [[nodiscard]] const mapped_type& at(const key_type& key) const
+        {
+            const const_iterator loc = find(key);
+
+            if (loc == cend())
+                throw std::out_of_range("Key not found!");
+            else
+                return loc->second;
+        }
+
+        [[nodiscard]] mapped_type& at(const key_type& key)
+        {
+            return const_cast<mapped_type&>(static_cast<const flat_hash_map&>(*this).at(key));
+        }
+
+        mapped_type& operator[](const key_type& key)
+        {
+            return try_emplace(key).first->second;
+        }
+
+        mapped_type& operator[](key_type&& key)
+        {
+            return try_emplace(std::move(key)).first->second;
+        }
+
+    public: //Insertion functions
+        template<class ... Args>
+        std::pair<iterator, bool> try_emplace(const key_type& key, Args&& ... args)
+        {
+            return _emplace_unique(key, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+        }
+
+        template<class ... Args>
+        std::pair<iterator, bool> try_emplace(key_type&& key, Args&& ... args)
+        {
+            return _emplace_unique(key, std::piecewise_construct, std::forward_as_tuple(std::move(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+        }
+
+        template<class ... Args>
+        std::pair<iterator, bool> emplace(Args&& ... args)
+        {
+            //Note: The key is only known once constructed
+            value_type value(std::forward<Args>(args)...);
+            return _emplace_unique(value.first, std::move(value));
+        }
+
+        std::pair<iterator, bool> insert(const value_type& value)
+        {
+            return _emplace_unique(value.first, value);
+        }
+
+        std::pair<iterator, bool> insert(value_type&& value)
+        {
+            return _emplace_unique(value.first, std::move(value));
+        }
+
+        template<std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+        void insert(InputIt first, const Sentinel last)
+        {
+            if constexpr (std::sized_sentinel_for<Sentinel, InputIt>)
+                reserve(_size + static_cast<size_type>(last - first));
+
+            for (; first != last; ++first)
+                insert(*first);
+        }
+
+    public: //Erasion functions
+        size_type erase(const key_type& key)
+        {
+            const size_type index = _find_index(key, _hash_of(key));
+            if (index == _capacity)
+                return 0;
+
+            _erase_at(index);
+            return 1;
+        }
+
+        iterator erase(const const_iterator pos) noexcept
+        {
+            const auto index = static_cast<size_type>(pos._ctrl - _ctrl());
+
+            _erase_at(index);
+            return _iterator_at(index);
+        }
+
+        void clear() noexcept
+        {
+            if (_capacity == 0)
+                return;
+
+            _destroy_elements();
+            _reset_ctrl();
+        }
+
+    public: //Capacity
+        //Ensures count elements may be held without rehashing
+        void reserve(const size_type count)
+        {
+            if (count > _size + _growth_left)
+                _resize(_growth_to_capacity(count));
+        }
+
+        [[nodiscard]] size_type capacity() const noexcept { return _capacity; }
+
+        [[nodiscard]] float load_factor() const noexcept
+        {
+            return _capacity != 0 ? static_cast<float>(_size) / static_cast<float>(_capacity) : 0.0f;
+        }
+
+    public: //Comparison operators
+        [[nodiscard]] friend bool operator==(const flat_hash_map& lhs, const flat_hash_map& rhs)
+        {
+            if (lhs.size() != rhs.size())
+                return false;
+
+            for (const value_type& value : lhs) {
+                const const_iterator loc = rhs.find(value.first);
+
+                if (loc == rhs.cend() || !(loc->second == value.second))
+                    return false;
+            }
+
+            return true;
+        }
+
+    public:
+        void swap(flat_hash_map& other) noexcept
+        {
+            std::swap(_slots,       other._slots);
+            std::swap(_ctrls,       other._ctrls);
+            std::swap(_capacity,    other._capacity);
+            std::swap(_size,        other._size);
+            std::swap(_growth_left, other._growth_left);
+            std::swap(_functors,    other._functors);
+        }
+
+    public: //Size getters
+        [[nodiscard]] size_type size()     const noexcept { return _size; }
+        [[nodiscard]] size_type max_size() const noexcept { return std::allocator_traits<_slot_alloc>::max_size(_slots.get_allocator()); }
+        [[nodiscard]] bool      empty()    const noexcept { return _size == 0; }
+
+        [[nodiscard]] hasher    hash_function() const { return _hash(); }
+        [[nodiscard]] key_equal key_eq()        const { return _key_eq(); }
+
+    public: //Iterator getters
+        [[nodiscard]] iterator begin() noexcept { return _iterator_at(0); }
+        [[nodiscard]] iterator end()   noexcept { return _iterator_at(_capacity); }
+
+        [[nodiscard]] const_iterator begin()  const noexcept { return _iterator_at(0); }
+        [[nodiscard]] const_iterator end()    const noexcept { return _iterator_at(_capacity); }
+        [[nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
+        [[nodiscard]] const_iterator cend()   const noexcept { return end(); }
+
+    private: //private member getters
+        [[nodiscard]] const Hash&     _hash()   const noexcept { return _functors.first(); }
+        [[nodiscard]] const KeyEqual& _key_eq() const noexcept { return _functors.second(); }
+
+    private:
+        _slots_type _slots;
+        _ctrls_type _ctrls;
+
+        size_type _capacity    = 0;
+        size_type _size        = 0;
+        size_type _growth_left = 0;
+
+        compressed_pair<Hash, KeyEqual> _functors;
+    };
+
+    template<template_of<flat_hash_map> FlatHashMap>
+    void swap(FlatHashMap& lhs, FlatHashMap& rhs)
+        noexcept(noexcept(lhs.swap(rhs)))
+    {
+        lhs.swap(rhs);
+    }
+}
+
+#endif // !EXPU_CONTAINERS_FLAT_HASH_MAP_HPP_INCLUDED
@@ -0,0 +1,119 @@
+#ifndef EXPU_CONTAINERS_GROWTH_POLICIES_HPP_INCLUDED
+#define EXPU_CONTAINERS_GROWTH_POLICIES_HPP_INCLUDED
+
+#include <algorithm> //For access to min and max
+#include <concepts>
+
+#include "expu/maths/basic_maths.hpp"
+#include "expu/mem_utils.hpp"
+
+/*
+* Growth policies decide the capacity a container reallocates to, once it runs out of space. Each policy
+* provides:
+*
+*   template<std::unsigned_integral SizeType>
+*   static constexpr SizeType next_capacity(SizeType size, SizeType min_capacity, SizeType max_size, size_t element_size);
+*
+* Note: Containers clamp the result to [min_capacity, max_size], hence policies only need to avoid overflow.
+*
+* Policies may also provide a static copy_policy (see expu::parallel_policy), with which containers copy or relocate
+* whole buffers, e.g. on copy construction and reallocation. Otherwise such copies are sequential.
+*/
+
+namespace expu {
+
+    //Grows capacity by a factor of Numerator/Denominator, e.g. 1.5x for <3, 2> and 2x for <2, 1>.
+    template<size_t Numerator, size_t Denominator>
+    struct geometric_growth
+    {
+        static_assert(Denominator < Numerator, "Growth factor must be greater than one!");
+
+        template<std::unsigned_integral SizeType>
+        [[nodiscard]] static constexpr SizeType next_capacity(const SizeType size, const SizeType min_capacity, const SizeType max_size, size_t)
+            noexcept
+        {
+            //Note: Equivalent to size * (Numerator - Denominator) / Denominator, but avoids overflow
+            const SizeType increase =
+                static_cast<SizeType>((size / Denominator) * (Numerator - Denominator) + (size % Denominator) * (Numerator - Denominator) / Denominator);
+
+            if (max_size - increase < size)
+                return max_size;
+            else
+                return std::max(min_capacity, static_cast<SizeType>(size + increase));
+        }
+    };
+
+    //Never allocates more than is required, minimising slack at the expense of more frequent reallocations.
+    struct exact_growth
+    {
+        template<std::unsigned_integral SizeType>
+        [[nodiscard]] static constexpr SizeType next_capacity(SizeType, const SizeType min_capacity, SizeType, size_t)
+            noexcept
+        {
+            return min_capacity;
+        }
+    };
+
+    //Rounds the capacity of BasePolicy up such that the buffer fills whole pages.
+    template<class BasePolicy = geometric_growth<3, 2>, size_t PageSize = 4096>
+    struct page_rounded_growth
+    {
+        static_assert((PageSize & (PageSize - 1)) == 0, "Page size must be a power of two!");
+
+        template<std::unsigned_integral SizeType>
+        [[nodiscard]] static constexpr SizeType next_capacity(const SizeType size, const SizeType min_capacity, const SizeType max_size, const size_t element_size)
+            noexcept
+        {
+            const SizeType capacity = BasePolicy::next_capacity(size, min_capacity, max_size, element_size);
+
+            //Note: Leave capacity as is, if rounding its size in bytes would overflow.
+            if ((static_cast<size_t>(-1) - PageSize) / element_size < capacity)
+                return capacity;
+
+            const size_t bytes = (capacity * element_size + PageSize - 1) & ~(PageSize - 1);
+            return static_cast<SizeType>(std::min<size_t>(bytes / element_size, max_size));
+        }
+    };
+
+    //Rounds the capacity of BasePolicy up to the next jemalloc size class, such that the allocator's internal
+    //rounding is made use of rather than wasted. Size classes are spaced four per doubling (e.g. 128, 160, 192, 224, 256).
+    template<class BasePolicy = geometric_growth<3, 2>>
+    struct jemalloc_size_class_growth
+    {
+        [[nodiscard]] static constexpr size_t size_class(const size_t bytes) noexcept
+        {
+            if (bytes <= 8)
+                return 8;
+            if (bytes <= 128)
+                return (bytes + 15) & ~size_t(15);
+
+            const size_t delta = size_t(1) << (int_log2(bytes - 1) - 2);
+            return (bytes + delta - 1) & ~(delta - 1);
+        }
+
+        template<std::unsigned_integral SizeType>
+        [[nodiscard]] static constexpr SizeType next_capacity(const SizeType size, const SizeType min_capacity, const SizeType max_size, const size_t element_size)
+            noexcept
+        {
+            const SizeType capacity = BasePolicy::next_capacity(size, min_capacity, max_size, element_size);
+
+            //Note: Rounding up never more than a quarter, hence below guards against overflow.
+            if ((static_cast<size_t>(-1) >> 2) / element_size < capacity)
+                return capacity;
+
+            return static_cast<SizeType>(std::min<size_t>(size_class(capacity * element_size) / element_size, max_size));
+        }
+    };
+
+    using default_growth = geometric_growth<3, 2>;
+
+    //Grows as BasePolicy, but copies buffers of at least MinParallelBytes across threads. Intended for arrays of
+    //large, trivially copyable elements (e.g. in-memory tables), whose copies are otherwise bound by a single core.
+    template<class BasePolicy = default_growth, size_t MinParallelBytes = parallel_policy{}.min_parallel_bytes>
+    struct parallel_copy_growth : BasePolicy
+    {
+        static constexpr parallel_policy copy_policy{ MinParallelBytes };
+    };
+}
+
+#endif // !EXPU_CONTAINERS_GROWTH_POLICIES_HPP_INCLUDED
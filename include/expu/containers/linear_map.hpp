@@ -1,18 +1,227 @@
-#ifndef EXPU_STATIC_MAP_HPP_INCLUDED
-#define EXPU_STATIC_MAP_HPP_INCLUDED
+#ifndef EXPU_CONTAINERS_LINEAR_MAP_HPP_INCLUDED
+#define EXPU_CONTAINERS_LINEAR_MAP_HPP_INCLUDED
 
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
 #include <utility> 
 #include <vector>
 
 #include "expu/containers/darray.hpp"
+#include "expu/containers/split_darray.hpp"
+
+#include "expu/debug.hpp"
+
+#include "expu/mem_utils.hpp"
 
 namespace expu {
 
+    //////////////////////////////////////KEY SCAN///////////////////////////////////////////////////////////////////////////////
+
+
+    //Keys compared by bit pattern alone, hence they may be compared several at a time with vector instructions.
+    template<class KeyType, class KeyEqual>
+    constexpr bool _is_vector_scannable =
+        (std::is_integral_v<KeyType> || std::is_enum_v<KeyType> || std::is_pointer_v<KeyType>) &&
+        (sizeof(KeyType) == 1 || sizeof(KeyType) == 2 || sizeof(KeyType) == 4 || sizeof(KeyType) == 8) &&
+        (std::is_same_v<KeyEqual, std::equal_to<KeyType>> || std::is_same_v<KeyEqual, std::equal_to<>>);
+
+    //KeyEqual comparing keys of other types, following the standard's is_transparent convention
+    template<class KeyEqual>
+    concept _transparent_key_equal = requires { typename KeyEqual::is_transparent; };
+
+    //Containers exposing their keys contiguously, such as split_darray
+    template<class Container>
+    concept _contiguous_key_container = requires(const Container& container) {
+        { container.keys() } -> std::convertible_to<const typename Container::value_type::first_type*>;
+    };
+
+#if defined(EXPU_HAS_SSE2)
+    template<size_t KeySize>
+    [[nodiscard]] inline __m128i _vector_key_equal(const __m128i lhs, const __m128i rhs) noexcept
+    {
+        if constexpr (KeySize == 1)
+            return _mm_cmpeq_epi8(lhs, rhs);
+        else if constexpr (KeySize == 2)
+            return _mm_cmpeq_epi16(lhs, rhs);
+        else if constexpr (KeySize == 4)
+            return _mm_cmpeq_epi32(lhs, rhs);
+        //Note: SSE2 lacks a 64 bit comparison, so both 32 bit halves must match
+        else {
+            const __m128i halves = _mm_cmpeq_epi32(lhs, rhs);
+            return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+        }
+    }
+
+#if defined(EXPU_HAS_AVX2)
+    template<size_t KeySize>
+    [[nodiscard]] inline __m256i _vector_key_equal(const __m256i lhs, const __m256i rhs) noexcept
+    {
+        if constexpr (KeySize == 1)
+            return _mm256_cmpeq_epi8(lhs, rhs);
+        else if constexpr (KeySize == 2)
+            return _mm256_cmpeq_epi16(lhs, rhs);
+        else if constexpr (KeySize == 4)
+            return _mm256_cmpeq_epi32(lhs, rhs);
+        else
+            return _mm256_cmpeq_epi64(lhs, rhs);
+    }
+#endif
+
+    //Returns the index of the first key equal to key, or count if there is none.
+    template<class KeyType>
+    [[nodiscard]] inline size_t _vector_find_key(const KeyType* const keys, const size_t count, const KeyType key) noexcept
+    {
+        using bits_type =
+            std::conditional_t<sizeof(KeyType) == 1, uint8_t,
+            std::conditional_t<sizeof(KeyType) == 2, uint16_t,
+            std::conditional_t<sizeof(KeyType) == 4, uint32_t, uint64_t>>>;
+
+        const bits_type key_bits = std::bit_cast<bits_type>(key);
+        const char*     bytes    = reinterpret_cast<const char*>(keys);
+
+        size_t index = 0;
+
+#if defined(EXPU_HAS_AVX2)
+        constexpr size_t keys_per_ymm = 32 / sizeof(KeyType);
+
+        if (count >= keys_per_ymm) {
+            __m256i broadcast;
+            if constexpr (sizeof(KeyType) == 1)
+                broadcast = _mm256_set1_epi8(static_cast<char>(key_bits));
+            else if constexpr (sizeof(KeyType) == 2)
+                broadcast = _mm256_set1_epi16(static_cast<short>(key_bits));
+            else if constexpr (sizeof(KeyType) == 4)
+                broadcast = _mm256_set1_epi32(static_cast<int>(key_bits));
+            else
+                broadcast = _mm256_set1_epi64x(static_cast<long long>(key_bits));
+
+            for (; index + keys_per_ymm <= count; index += keys_per_ymm) {
+                const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + index * sizeof(KeyType)));
+                const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(_vector_key_equal<sizeof(KeyType)>(block, broadcast)));
+
+                if (mask)
+                    return index + std::countr_zero(mask) / sizeof(KeyType);
+            }
+        }
+#endif
+
+        constexpr size_t keys_per_xmm = 16 / sizeof(KeyType);
+
+        if (count - index >= keys_per_xmm) {
+            __m128i broadcast;
+            if constexpr (sizeof(KeyType) == 1)
+                broadcast = _mm_set1_epi8(static_cast<char>(key_bits));
+            else if constexpr (sizeof(KeyType) == 2)
+                broadcast = _mm_set1_epi16(static_cast<short>(key_bits));
+            else if constexpr (sizeof(KeyType) == 4)
+                broadcast = _mm_set1_epi32(static_cast<int>(key_bits));
+            else
+                broadcast = _mm_set1_epi64x(static_cast<long long>(key_bits));
+
+            for (; index + keys_per_xmm <= count; index += keys_per_xmm) {
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + index * sizeof(KeyType)));
+                const uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(_vector_key_equal<sizeof(KeyType)>(block, broadcast)));
+
+                if (mask)
+                    return index + std::countr_zero(mask) / sizeof(KeyType);
+            }
+        }
+
+        //Note: A remaining 8 bytes of small keys are compared with a half width load
+        constexpr size_t keys_per_qword = 8 / sizeof(KeyType);
+
+        if (keys_per_qword > 1 && count - index >= keys_per_qword) {
+            const uint64_t repeated = uint64_t(key_bits) * (~uint64_t(0) / bits_type(~bits_type(0)));
+
+            const __m128i block     = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(bytes + index * sizeof(KeyType)));
+            const __m128i broadcast = _mm_set1_epi64x(static_cast<long long>(repeated));
+            const uint32_t mask     = static_cast<uint32_t>(_mm_movemask_epi8(_vector_key_equal<sizeof(KeyType)>(block, broadcast))) & 0xFF;
+
+            if (mask)
+                return index + std::countr_zero(mask) / sizeof(KeyType);
+
+            index += keys_per_qword;
+        }
+
+        for (; index != count; ++index)
+            if (keys[index] == key)
+                return index;
+
+        return count;
+    }
+#endif
+
+    template<class KeyType, class LookupKey, class KeyEqual>
+    [[nodiscard]] constexpr size_t _find_key(const KeyType* const keys, const size_t count, const LookupKey& key, const KeyEqual& key_equal)
+    {
+#if defined(EXPU_HAS_SSE2)
+        if constexpr (_is_vector_scannable<KeyType, KeyEqual> && std::is_same_v<LookupKey, KeyType>)
+            if (!std::is_constant_evaluated())
+                return _vector_find_key(keys, count, key);
+#endif
+
+        for (size_t index = 0; index != count; ++index)
+            if (key_equal(keys[index], key))
+                return index;
+
+        return count;
+    }
+
+
+    //////////////////////////////////////ERASE POLICIES///////////////////////////////////////////////////////////////////////////////
+
+
+    /*
+    * Erase policies decide how linear_map removes an element from its Container. Each policy provides:
+    *
+    *   template<class Container>
+    *   static constexpr void erase(Container& elements, typename Container::const_iterator at);
+    */
+
+    //Shifts all subsequent elements down, preserving insertion order.
+    struct ordered_erase
+    {
+        template<class Container>
+        static constexpr void erase(Container& elements, const typename Container::const_iterator at)
+        {
+            elements.erase(at);
+        }
+    };
+
+    //Moves the last element into the erased element's place, taking constant time.
+    struct unordered_erase
+    {
+        template<class Container>
+        static constexpr void erase(Container& elements, const typename Container::const_iterator at)
+        {
+            if constexpr (requires { elements.erase_unordered(at); })
+                elements.erase_unordered(at);
+            else {
+                const auto naked_at = elements.begin() + (at - elements.cbegin());
+                const auto last     = std::prev(elements.end());
+
+                if (naked_at != last)
+                    *naked_at = std::move(*last);
+
+                elements.pop_back();
+            }
+        }
+    };
+
+
+    //////////////////////////////////////LINEAR MAP///////////////////////////////////////////////////////////////////////////////
+
+
+    //Note: Iteration order is only insertion order when erasing with ordered_erase.
     template<
         class KeyType,
         class MappedType,
-        class Container = std::vector<std::pair<KeyType, MappedType>>,
-        class KeyEqual  = std::equal_to<KeyType>> 
+        class Container   = std::vector<std::pair<KeyType, MappedType>>,
+        class KeyEqual    = std::equal_to<KeyType>,
+        class ErasePolicy = ordered_erase> 
     class linear_map {
     public: //Typedefs
         using key_type       = KeyType;
@@ -26,6 +235,10 @@ namespace expu {
 
         static_assert(std::is_same_v<value_type, std::pair<KeyType, MappedType>>, "Container must be of type std::pair");
 
+        //Note: Containers with contiguous keys (e.g. split_darray) are searched by scanning the keys alone,
+        //which is vectorised for integral, enum and pointer keys compared with std::equal_to.
+        static constexpr bool _scans_keys = _contiguous_key_container<Container>;
+
     public: //Constructors
         template<class ... Args>
         requires std::is_constructible_v<Container, Args...>
@@ -33,61 +246,145 @@ namespace expu {
             noexcept(std::is_nothrow_constructible_v<Container, Args...>):
             _elements(std::forward<Args>(args)...) {}
 
-    public:
+    public: //Lookup functions
+        //Note: Keys of other types are accepted when KeyEqual is transparent (e.g. std::equal_to<>),
+        //avoiding the construction of a temporary key_type on every lookup.
         [[nodiscard]] constexpr const_iterator find(const key_type& key) const 
         {
             //Note: Safe to do since find is a const function
-            return const_cast<linear_map&>(*this).find(key);
+            return const_cast<linear_map&>(*this)._find(key);
         }
 
         [[nodiscard]] constexpr iterator find(const key_type& key)
         {
-            return std::ranges::find(*this, key, &value_type::first);
+            return _find(key);
+        }
+
+        template<class LookupKey>
+        requires _transparent_key_equal<KeyEqual>
+        [[nodiscard]] constexpr const_iterator find(const LookupKey& key) const
+        {
+            return const_cast<linear_map&>(*this)._find(key);
+        }
+
+        template<class LookupKey>
+        requires _transparent_key_equal<KeyEqual>
+        [[nodiscard]] constexpr iterator find(const LookupKey& key)
+        {
+            return _find(key);
         }
 
     public: // Indexing functions
         [[nodiscard]] constexpr const mapped_type& at(const key_type& key) const
         {
-            const const_iterator loc = find(key);
-
-            if (loc == cend())
-                throw std::out_of_range("Key not found!");
-            else
-                return loc->second;
+            return _at(key);
         }
 
         [[nodiscard]] constexpr mapped_type& at(const key_type& key)
         {
-            return const_cast<value_type&>(static_cast<const linear_map&>(*this).at(key));
+            return const_cast<mapped_type&>(_at(key));
+        }
+
+        template<class LookupKey>
+        requires _transparent_key_equal<KeyEqual>
+        [[nodiscard]] constexpr const mapped_type& at(const LookupKey& key) const
+        {
+            return _at(key);
+        }
+
+        template<class LookupKey>
+        requires _transparent_key_equal<KeyEqual>
+        [[nodiscard]] constexpr mapped_type& at(const LookupKey& key)
+        {
+            return const_cast<mapped_type&>(_at(key));
         }
 
         [[nodiscard]] constexpr const mapped_type& operator[](const key_type& key) const
         {
             const const_iterator loc = find(key);
-            //Todo: Add debug check
+            EXPU_VERIFY_DEBUG(loc != cend(), "Key not found!");
             return loc->second;
         }
 
         constexpr mapped_type& operator[](const key_type& key)
+        {
+            return _index(key);
+        }
+
+        template<class LookupKey>
+        requires _transparent_key_equal<KeyEqual>
+        [[nodiscard]] constexpr const mapped_type& operator[](const LookupKey& key) const
         {
             const const_iterator loc = find(key);
+            EXPU_VERIFY_DEBUG(loc != cend(), "Key not found!");
+            return loc->second;
+        }
+
+        //Note: A key_type is only constructed from key if it is absent
+        template<class LookupKey>
+        requires _transparent_key_equal<KeyEqual> && std::is_constructible_v<key_type, const LookupKey&>
+        constexpr mapped_type& operator[](const LookupKey& key)
+        {
+            return _index(key);
+        }
+
+    public: //Erasion functions
+        constexpr void erase(const key_type& key)
+        {
+            _erase(key);
+        }
+
+        template<class LookupKey>
+        requires _transparent_key_equal<KeyEqual>
+        constexpr void erase(const LookupKey& key)
+        {
+            _erase(key);
+        }
+
+    private:
+        template<class LookupKey>
+        [[nodiscard]] constexpr iterator _find(const LookupKey& key)
+        {
+            if constexpr (_scans_keys)
+                return begin() + _find_key(_elements.keys(), _elements.size(), key, key_equal());
+            else
+                return std::ranges::find_if(*this, [&key](const value_type& elem) {
+                    return key_equal()(elem.first, key);
+                });
+        }
+
+        template<class LookupKey>
+        [[nodiscard]] constexpr const mapped_type& _at(const LookupKey& key) const
+        {
+            const const_iterator loc = const_cast<linear_map&>(*this)._find(key);
+
+            if (loc == cend())
+                throw std::out_of_range("Key not found!");
+            else
+                return loc->second;
+        }
+
+        template<class LookupKey>
+        constexpr mapped_type& _index(const LookupKey& key)
+        {
+            const const_iterator loc = _find(key);
 
             if (loc == cend())
                 //Note: The standard does not require that a SequentialContainer's
                 //emplace_back return anything, unlike emplace 
-                return _elements.emplace(cend(), key, mapped_type())->second;
+                return _elements.emplace(cend(), key_type(key), mapped_type())->second;
             else
                 //Note: Safe to do since container is non-const
                 return const_cast<mapped_type&>(loc->second);
         }
 
-    public: //Erasion functions
-        constexpr void erase(const key_type& key)
+        template<class LookupKey>
+        constexpr void _erase(const LookupKey& key)
         {
-            const const_iterator loc = find(key);
+            const const_iterator loc = _find(key);
 
             if (loc != cend())
-                _elements.erase(loc);
+                ErasePolicy::erase(_elements, loc);
         }
 
     public: //Comparison operators
@@ -134,4 +431,4 @@ namespace expu {
     }
 }
 
-#endif // !EXPU_STATIC_MAP_HPP_INCLUDED
\ No newline at end of file
+#endif // !EXPU_CONTAINERS_LINEAR_MAP_HPP_INCLUDED
\ No newline at end of file
@@ -0,0 +1,249 @@
+#ifndef EXPU_CONTAINERS_MPMC_QUEUE_HPP_INCLUDED
+#define EXPU_CONTAINERS_MPMC_QUEUE_HPP_INCLUDED
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "expu/mem_utils.hpp"
+
+namespace expu {
+
+    //////////////////////////////////////MPMC QUEUE///////////////////////////////////////////////////////////////////////////////
+
+
+    //Bounded, lock-free, multi producer multi consumer FIFO queue. A ring of cells, each tagged with a sequence
+    //number stating whether it is ready to be written or read on the current lap (see D. Vyukov's bounded MPMC queue).
+    //Producers and consumers only contend on their own index, each kept on a separate cache line.
+    //Note: Capacity is rounded up to a power of two, and at least 2.
+    template<class Type, class Alloc = std::allocator<Type>>
+    class alignas(_cache_line_size) mpmc_queue
+    {
+    private:
+        using _alloc_traits = std::allocator_traits<Alloc>;
+        //Ensure allocator value_type matches the container type
+        static_assert(std::is_same_v<Type, typename _alloc_traits::value_type>);
+
+        //Note: Elements are moved in to and out of cells which have already been claimed, hence must not throw
+        static_assert(std::is_nothrow_move_constructible_v<Type> && std::is_nothrow_destructible_v<Type>,
+            "mpmc_queue requires nothrow move constructible and destructible types.");
+
+    public: //Typedefs
+        using allocator_type  = Alloc;
+        using value_type      = Type;
+        using size_type       = typename _alloc_traits::size_type;
+        using difference_type = typename _alloc_traits::difference_type;
+
+    private:
+        struct _cell
+        {
+            explicit _cell(const size_type initial_sequence) noexcept :
+                sequence(initial_sequence) {}
+
+            [[nodiscard]] Type* value() noexcept
+            {
+                return std::launder(reinterpret_cast<Type*>(storage));
+            }
+
+            std::atomic<size_type> sequence;
+            alignas(Type) std::byte storage[sizeof(Type)];
+        };
+
+        using _cell_alloc  = typename _alloc_traits::template rebind_alloc<_cell>;
+        using _cell_traits = std::allocator_traits<_cell_alloc>;
+        using _cell_ptr    = typename _cell_traits::pointer;
+
+    public: //Constructors
+        explicit mpmc_queue(const size_type capacity, const Alloc& alloc = Alloc()) :
+            _cpair(one_then_variadic{}, alloc, nullptr),
+            _mask(std::bit_ceil(std::max(capacity, size_type(2))) - 1)
+        {
+            _cell_alloc cell_alloc(_alloc());
+            _cells() = _cell_traits::allocate(cell_alloc, _mask + 1);
+
+            for (size_type i = 0; i <= _mask; ++i)
+                std::construct_at(std::to_address(_cells() + i), i);
+        }
+
+        mpmc_queue(const mpmc_queue&)            = delete;
+        mpmc_queue& operator=(const mpmc_queue&) = delete;
+
+        //Note: Must not be called whilst other threads are accessing the queue
+        ~mpmc_queue() noexcept
+        {
+            const size_type tail = _tail.load(std::memory_order_acquire);
+
+            for (size_type pos = _head.load(std::memory_order_acquire); pos != tail; ++pos)
+                _alloc_traits::destroy(_alloc(), _cell_at(pos).value());
+
+            _cell_alloc cell_alloc(_alloc());
+            std::destroy_n(std::to_address(_cells()), _mask + 1);
+            _cell_traits::deallocate(cell_alloc, _cells(), _mask + 1);
+        }
+
+    public: //Producer functions
+        //Returns false, without constructing anything in the queue, if it is full.
+        //Note: Types which may throw on construction are constructed before claiming a cell, hence even if full.
+        template<class ... Args>
+        bool try_emplace(Args&& ... args)
+        {
+            if constexpr (!std::is_nothrow_constructible_v<Type, Args...>)
+                return try_emplace(Type(std::forward<Args>(args)...));
+            else {
+                const auto [pos, count] = _claim(_tail, 1, 0);
+
+                if (count == 0)
+                    return false;
+
+                _publish(pos, std::forward<Args>(args)...);
+                return true;
+            }
+        }
+
+        bool try_push(const Type& value) { return try_emplace(value); }
+        bool try_push(Type&& value)      { return try_emplace(std::move(value)); }
+
+        //Pushes up to n elements of [first, first + n), claiming cells in one step. Returns how many were pushed.
+        template<std::input_iterator InputIt>
+        requires std::is_nothrow_constructible_v<Type, std::iter_reference_t<InputIt>>
+        size_type try_push_n(InputIt first, const size_type n) noexcept
+        {
+            const auto [pos, count] = _claim(_tail, n, 0);
+
+            for (size_type i = 0; i != count; ++i, ++first)
+                _publish(pos + i, *first);
+
+            return count;
+        }
+
+    public: //Consumer functions
+        //Returns false, leaving out untouched, if the queue is empty.
+        bool try_pop(Type& out)
+        {
+            return try_pop_n(std::addressof(out), 1) != 0;
+        }
+
+        //Pops up to n elements in to out, claiming cells in one step. Returns how many were popped.
+        //Note: If writing to out throws, the remaining claimed elements are discarded.
+        template<std::weakly_incrementable OutputIt>
+        requires std::indirectly_writable<OutputIt, Type&&>
+        size_type try_pop_n(OutputIt out, const size_type n)
+        {
+            const auto [pos, count] = _claim(_head, n, 1);
+
+            size_type i = 0;
+            try {
+                for (; i != count; ++i, ++out) {
+                    *out = std::move(*_cell_at(pos + i).value());
+                    _release(pos + i);
+                }
+            }
+            catch (...) {
+                for (; i != count; ++i)
+                    _release(pos + i);
+
+                throw;
+            }
+
+            return count;
+        }
+
+    public: //Size getters
+        [[nodiscard]] size_type capacity() const noexcept { return _mask + 1; }
+
+        //Note: Only a snapshot, other threads may push or pop concurrently
+        [[nodiscard]] size_type size_approx() const noexcept
+        {
+            const size_type head = _head.load(std::memory_order_relaxed);
+            const size_type tail = _tail.load(std::memory_order_relaxed);
+
+            return std::min(static_cast<size_type>(tail - head), capacity());
+        }
+
+        [[nodiscard]] allocator_type get_allocator() const noexcept { return _alloc(); }
+
+    private:
+        [[nodiscard]] _cell& _cell_at(const size_type pos) const noexcept
+        {
+            return _cells()[pos & _mask];
+        }
+
+        //Claims up to n consecutive cells starting at index, each ready once its sequence equals pos + ready_offset.
+        //Returns the first claimed position and the count, zero if the queue is full (producers) or empty (consumers).
+        //Note: A cell seen ready stays so until index passes it, hence only index needs a compare and swap.
+        [[nodiscard]] std::pair<size_type, size_type> _claim(
+            std::atomic<size_type>& index, const size_type n, const size_type ready_offset) const noexcept
+        {
+            const size_type max_count = std::min(n, capacity());
+
+            size_type pos = index.load(std::memory_order_relaxed);
+
+            for (;;) {
+                size_type count = 0;
+
+                for (; count != max_count; ++count) {
+                    const size_type sequence = _cell_at(pos + count).sequence.load(std::memory_order_acquire);
+                    const auto      lag      = static_cast<difference_type>(sequence - (pos + count + ready_offset));
+
+                    if (lag == 0)
+                        continue;
+
+                    //Cell is yet to be released from the previous lap
+                    if (count == 0 && lag < 0)
+                        return { pos, 0 };
+
+                    break;
+                }
+
+                if (count == 0) {
+                    //Another thread has claimed pos
+                    pos = index.load(std::memory_order_relaxed);
+                    continue;
+                }
+
+                if (index.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed))
+                    return { pos, count };
+            }
+        }
+
+        template<class ... Args>
+        void _publish(const size_type pos, Args&& ... args) noexcept
+        {
+            _cell& cell = _cell_at(pos);
+
+            _alloc_traits::construct(_alloc(), reinterpret_cast<Type*>(cell.storage), std::forward<Args>(args)...);
+            cell.sequence.store(pos + 1, std::memory_order_release);
+        }
+
+        void _release(const size_type pos) noexcept
+        {
+            _cell& cell = _cell_at(pos);
+
+            _alloc_traits::destroy(_alloc(), cell.value());
+            cell.sequence.store(pos + _mask + 1, std::memory_order_release);
+        }
+
+    private:
+        [[nodiscard]] Alloc&       _alloc()       noexcept { return _cpair.first(); }
+        [[nodiscard]] const Alloc& _alloc() const noexcept { return _cpair.first(); }
+
+        [[nodiscard]] _cell_ptr&       _cells()       noexcept { return _cpair.second(); }
+        [[nodiscard]] const _cell_ptr& _cells() const noexcept { return _cpair.second(); }
+
+    private:
+        compressed_pair<Alloc, _cell_ptr> _cpair;
+        size_type                         _mask;
+
+        //Consumers claim from the head, producers from the tail
+        alignas(_cache_line_size) std::atomic<size_type> _head = 0;
+        alignas(_cache_line_size) std::atomic<size_type> _tail = 0;
+    };
+}
+
+#endif // !EXPU_CONTAINERS_MPMC_QUEUE_HPP_INCLUDED
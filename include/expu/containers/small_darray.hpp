@@ -0,0 +1,39 @@
+#ifndef EXPU_CONTAINERS_SMALL_DARRAY_HPP_INCLUDED
+#define EXPU_CONTAINERS_SMALL_DARRAY_HPP_INCLUDED
+
+#include <memory>
+
+#include "expu/containers/darray.hpp"
+
+namespace expu {
+
+    //expu::darray which stores up to InlineCapacity elements within itself, only allocating once exceeded.
+    //Note: Moving a small_darray whose elements are stored inline moves each element individually.
+    template<
+        class Type,
+        size_t InlineCapacity,
+        class Alloc        = std::allocator<Type>,
+        class GrowthPolicy = default_growth>
+    class small_darray : public _basic_darray<Type, Alloc, GrowthPolicy, InlineCapacity>
+    {
+    private:
+        using _base = _basic_darray<Type, Alloc, GrowthPolicy, InlineCapacity>;
+
+        static_assert(InlineCapacity != 0, "Use expu::darray when no inline capacity is required.");
+
+    public:
+        using typename _base::size_type;
+
+        static constexpr size_type inline_capacity = InlineCapacity;
+
+    public:
+        using _base::_base;
+
+    public:
+        //Whether elements are currently stored within the inline buffer
+        [[nodiscard]] constexpr bool is_inline() const noexcept { return _base::_is_inline(); }
+    };
+
+}
+
+#endif // !EXPU_CONTAINERS_SMALL_DARRAY_HPP_INCLUDED
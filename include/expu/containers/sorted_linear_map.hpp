@@ -0,0 +1,293 @@
+#ifndef EXPU_CONTAINERS_SORTED_LINEAR_MAP_HPP_INCLUDED
+#define EXPU_CONTAINERS_SORTED_LINEAR_MAP_HPP_INCLUDED
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "expu/containers/linear_map.hpp"
+
+#include "expu/debug.hpp"
+
+namespace expu {
+
+    //Lower bound whose loop body compiles to a conditional move, as the comparison is unpredictable when probing.
+    //Returns the index of the first element not ordered before key.
+    template<class RandomIt, class Key, class Compare, class Projection>
+    [[nodiscard]] constexpr size_t _branchless_lower_bound(
+        const RandomIt first, size_t count, const Key& key, Compare& comp, Projection proj)
+    {
+        size_t base = 0;
+
+        while (count > 1) {
+            const size_t half = count / 2;
+
+            base   = comp(std::invoke(proj, first[base + half]), key) ? base + half : base;
+            count -= half;
+        }
+
+        return base + static_cast<size_t>(count == 1 && comp(std::invoke(proj, first[base]), key));
+    }
+
+    //Map whose elements are kept sorted by key, giving logarithmic lookups over a contiguous container.
+    //Note: With a container exposing contiguous keys (e.g. split_darray) only the keys are touched whilst searching.
+    template<
+        class KeyType,
+        class MappedType,
+        class Container = std::vector<std::pair<KeyType, MappedType>>,
+        class Compare   = std::less<KeyType>>
+    class sorted_linear_map {
+    public: //Typedefs
+        using key_type        = KeyType;
+        using mapped_type     = MappedType;
+        using key_compare     = Compare;
+        using value_type      = typename Container::value_type;
+        using size_type       = typename Container::size_type;
+        using difference_type = typename Container::difference_type;
+        using iterator        = typename Container::iterator;
+        using const_iterator  = typename Container::const_iterator;
+
+        static_assert(std::is_same_v<value_type, std::pair<KeyType, MappedType>>, "Container must be of type std::pair");
+
+    private:
+        static constexpr bool _scans_keys = _contiguous_key_container<Container>;
+
+    public: //Constructors
+        constexpr sorted_linear_map() :
+            _cpair(zero_then_variadic{}) {}
+
+        template<std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+        constexpr sorted_linear_map(InputIt first, const Sentinel last) :
+            _cpair(zero_then_variadic{})
+        {
+            insert_range(std::move(first), last);
+        }
+
+        template<std::ranges::input_range Range>
+        requires(!std::is_same_v<std::remove_cvref_t<Range>, sorted_linear_map>)
+        constexpr explicit sorted_linear_map(Range&& range) :
+            _cpair(zero_then_variadic{})
+        {
+            insert_range(std::forward<Range>(range));
+        }
+
+    public: //Lookup functions
+        [[nodiscard]] constexpr const_iterator lower_bound(const key_type& key) const
+        {
+            //Note: Safe to do since lower_bound is a const function
+            return const_cast<sorted_linear_map&>(*this).lower_bound(key);
+        }
+
+        [[nodiscard]] constexpr iterator lower_bound(const key_type& key)
+        {
+            Compare& comp = _comp();
+
+            if constexpr (_scans_keys)
+                return begin() + _branchless_lower_bound(_cont().keys(), size(), key, comp, std::identity());
+            else
+                return begin() + _branchless_lower_bound(begin(), size(), key, comp, &value_type::first);
+        }
+
+        [[nodiscard]] constexpr const_iterator find(const key_type& key) const
+        {
+            //Note: Safe to do since find is a const function
+            return const_cast<sorted_linear_map&>(*this).find(key);
+        }
+
+        [[nodiscard]] constexpr iterator find(const key_type& key)
+        {
+            const iterator loc = lower_bound(key);
+
+            if (loc != end() && !_comp()(key, (*loc).first))
+                return loc;
+            else
+                return end();
+        }
+
+    public: // Indexing functions
+        [[nodiscard]] constexpr const mapped_type& at(const key_type& key) const
+        {
+            const const_iterator loc = find(key);
+
+            if (loc == cend())
+                throw std::out_of_range("Key not found!");
+            else
+                return loc->second;
+        }
+
+        [[nodiscard]] constexpr mapped_type& at(const key_type& key)
+        {
+            return const_cast<mapped_type&>(static_cast<const sorted_linear_map&>(*this).at(key));
+        }
+
+        [[nodiscard]] constexpr const mapped_type& operator[](const key_type& key) const
+        {
+            const const_iterator loc = find(key);
+            EXPU_VERIFY_DEBUG(loc != cend(), "Key not found!");
+            return loc->second;
+        }
+
+        constexpr mapped_type& operator[](const key_type& key)
+        {
+            const iterator loc = lower_bound(key);
+
+            if (loc == end() || _comp()(key, (*loc).first))
+                return _cont().emplace(loc, key, mapped_type())->second;
+            else
+                return loc->second;
+        }
+
+    public: //Insertion functions
+        //Sorts the new elements then merges them with the existing ones in a single pass.
+        //Note: Existing keys keep their values, and of duplicate new keys only the first is inserted.
+        template<std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+        constexpr void insert_range(InputIt first, const Sentinel last)
+        {
+            std::vector<value_type> additions;
+            if constexpr (std::sized_sentinel_for<Sentinel, InputIt>)
+                additions.reserve(static_cast<size_t>(last - first));
+
+            for (; first != last; ++first)
+                additions.emplace_back(*first);
+
+            if (additions.empty())
+                return;
+
+            Compare& comp = _comp();
+            const auto key_less = [&comp](const value_type& lhs, const value_type& rhs) {
+                return comp(lhs.first, rhs.first);
+            };
+
+            std::stable_sort(additions.begin(), additions.end(), key_less);
+
+            Container merged;
+            if constexpr (requires { merged.reserve(size_type()); })
+                merged.reserve(size() + additions.size());
+
+            auto existing = begin();
+            auto addition = additions.begin();
+
+            while (existing != end() && addition != additions.end()) {
+                const key_type& existing_key = (*existing).first;
+
+                if (comp(addition->first, existing_key)) {
+                    const auto next = _skip_key(std::next(addition), additions.end(), addition->first);
+                    merged.push_back(std::move(*addition));
+                    addition = next;
+                }
+                else {
+                    if (!comp(existing_key, addition->first))
+                        addition = _skip_key(addition, additions.end(), existing_key);
+
+                    merged.push_back(value_type(std::move(*existing)));
+                    ++existing;
+                }
+            }
+
+            for (; existing != end(); ++existing)
+                merged.push_back(value_type(std::move(*existing)));
+
+            while (addition != additions.end()) {
+                const auto next = _skip_key(std::next(addition), additions.end(), addition->first);
+                merged.push_back(std::move(*addition));
+                addition = next;
+            }
+
+            _cont() = std::move(merged);
+        }
+
+        template<std::ranges::input_range Range>
+        constexpr void insert_range(Range&& range)
+        {
+            insert_range(std::ranges::begin(range), std::ranges::end(range));
+        }
+
+    public: //Erasion functions
+        constexpr void erase(const key_type& key)
+        {
+            const const_iterator loc = find(key);
+
+            if (loc != cend())
+                _cont().erase(loc);
+        }
+
+    public: //Comparison operators
+        [[nodiscard]] constexpr bool operator==(const sorted_linear_map& other) const
+        {
+            return _cont() == other._cont();
+        }
+
+    public:
+        constexpr void swap(sorted_linear_map& other)
+            noexcept(std::is_nothrow_swappable_v<Container> && std::is_nothrow_swappable_v<Compare>)
+        {
+            using std::swap;
+
+            _cont().swap(other._cont());
+            swap(_comp(), other._comp());
+        }
+
+    public: //Size getters
+        [[nodiscard]] constexpr auto size()     const { return static_cast<size_type>(_cont().size()); }
+        [[nodiscard]] constexpr auto max_size() const { return static_cast<size_type>(_cont().max_size()); }
+        [[nodiscard]] constexpr auto empty()    const { return _cont().empty(); }
+
+        [[nodiscard]] constexpr key_compare key_comp() const { return _comp(); }
+
+    public: //Iterator getters
+        [[nodiscard]] constexpr iterator begin() noexcept { return _cont().begin(); }
+        [[nodiscard]] constexpr iterator end()   noexcept { return _cont().end();   }
+
+        [[nodiscard]] constexpr const_iterator begin()  const noexcept { return _cont().cbegin(); }
+        [[nodiscard]] constexpr const_iterator end()    const noexcept { return _cont().cend();   }
+        [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return _cont().cbegin(); }
+        [[nodiscard]] constexpr const_iterator cend()   const noexcept { return _cont().cend();   }
+
+    private:
+        //Returns the first addition whose key differs from key, additions being sorted
+        template<class AdditionIt>
+        constexpr AdditionIt _skip_key(AdditionIt first, const AdditionIt last, const key_type& key)
+        {
+            while (first != last && !_comp()(key, first->first))
+                ++first;
+
+            return first;
+        }
+
+        [[nodiscard]] constexpr Compare& _comp() noexcept
+        {
+            return _cpair.first();
+        }
+
+        [[nodiscard]] constexpr const Compare& _comp() const noexcept
+        {
+            return _cpair.first();
+        }
+
+        [[nodiscard]] constexpr Container& _cont() noexcept
+        {
+            return _cpair.second();
+        }
+
+        [[nodiscard]] constexpr const Container& _cont() const noexcept
+        {
+            return _cpair.second();
+        }
+
+    private:
+        compressed_pair<Compare, Container> _cpair;
+    };
+
+    template<template_of<sorted_linear_map> SortedLinearMap>
+    constexpr void swap(SortedLinearMap& lhs, SortedLinearMap& rhs)
+        noexcept(noexcept(lhs.swap(rhs)))
+    {
+        lhs.swap(rhs);
+    }
+}
+
+#endif // !EXPU_CONTAINERS_SORTED_LINEAR_MAP_HPP_INCLUDED
@@ -0,0 +1,314 @@
+#ifndef EXPU_CONTAINERS_SPLIT_DARRAY_HPP_INCLUDED
+#define EXPU_CONTAINERS_SPLIT_DARRAY_HPP_INCLUDED
+
+#include <algorithm>
+#include <compare>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+#include "expu/containers/darray.hpp"
+#include "expu/containers/growth_policies.hpp"
+
+#include "expu/debug.hpp"
+
+namespace expu {
+
+    //////////////////////////////////////ITERATORS///////////////////////////////////////////////////////////////////////////////
+
+
+    //Dereferencing yields a pair of references, hence operator-> must return a proxy holding it.
+    template<class Reference>
+    struct _split_arrow_proxy
+    {
+        [[nodiscard]] constexpr const Reference* operator->() const noexcept { return std::addressof(ref); }
+
+        Reference ref;
+    };
+
+    template<class KeyType, class MappedType>
+    class _split_iterator
+    {
+    public:
+        using iterator_concept  = std::random_access_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = std::pair<KeyType, std::remove_const_t<MappedType>>;
+        using reference         = std::pair<const KeyType&, MappedType&>;
+        using pointer           = _split_arrow_proxy<reference>;
+        using difference_type   = std::ptrdiff_t;
+
+    public:
+        constexpr _split_iterator() noexcept :
+            _key(nullptr), _mapped(nullptr) {}
+
+        constexpr _split_iterator(const KeyType* const key, MappedType* const mapped) noexcept :
+            _key(key), _mapped(mapped) {}
+
+        //Conversion from iterator to const_iterator
+        template<class OtherMappedType>
+        requires(std::is_convertible_v<OtherMappedType*, MappedType*> && !std::is_same_v<OtherMappedType, MappedType>)
+        constexpr _split_iterator(const _split_iterator<KeyType, OtherMappedType>& other) noexcept :
+            _key(other._key), _mapped(other._mapped) {}
+
+    private:
+        template<class, class>
+        friend class _split_iterator;
+
+        template<class, class, class, class>
+        friend class split_darray;
+
+    public:
+        [[nodiscard]] constexpr reference operator*()  const noexcept { return reference(*_key, *_mapped); }
+        [[nodiscard]] constexpr pointer   operator->() const noexcept { return pointer{ **this }; }
+
+        [[nodiscard]] constexpr reference operator[](const difference_type offset) const noexcept
+        {
+            return *(*this + offset);
+        }
+
+        constexpr _split_iterator& operator+=(const difference_type offset) noexcept
+        {
+            _key    += offset;
+            _mapped += offset;
+            return *this;
+        }
+
+        constexpr _split_iterator& operator-=(const difference_type offset) noexcept
+        {
+            return *this += -offset;
+        }
+
+        constexpr _split_iterator& operator++() noexcept { return *this += 1; }
+        constexpr _split_iterator& operator--() noexcept { return *this -= 1; }
+
+        constexpr _split_iterator operator++(int) noexcept
+        {
+            const _split_iterator copy(*this);
+            ++*this;
+            return copy;
+        }
+
+        constexpr _split_iterator operator--(int) noexcept
+        {
+            const _split_iterator copy(*this);
+            --*this;
+            return copy;
+        }
+
+        [[nodiscard]] friend constexpr _split_iterator operator+(_split_iterator it, const difference_type offset) noexcept
+        {
+            return it += offset;
+        }
+
+        [[nodiscard]] friend constexpr _split_iterator operator+(const difference_type offset, _split_iterator it) noexcept
+        {
+            return it += offset;
+        }
+
+        [[nodiscard]] friend constexpr _split_iterator operator-(_split_iterator it, const difference_type offset) noexcept
+        {
+            return it -= offset;
+        }
+
+        [[nodiscard]] friend constexpr difference_type operator-(const _split_iterator& lhs, const _split_iterator& rhs) noexcept
+        {
+            return lhs._key - rhs._key;
+        }
+
+        [[nodiscard]] friend constexpr bool operator==(const _split_iterator& lhs, const _split_iterator& rhs) noexcept
+        {
+            return lhs._key == rhs._key;
+        }
+
+        [[nodiscard]] friend constexpr std::strong_ordering operator<=>(const _split_iterator& lhs, const _split_iterator& rhs) noexcept
+        {
+            return lhs._key <=> rhs._key;
+        }
+
+    private:
+        const KeyType* _key;
+        MappedType*    _mapped;
+    };
+
+
+    //////////////////////////////////////SPLIT DARRAY///////////////////////////////////////////////////////////////////////////////
+
+
+    //Sequence of pairs stored as two parallel darrays (structure of arrays), keeping keys contiguous.
+    //Intended as the Container of a linear_map, whose find then scans keys() directly.
+    template<
+        class KeyType,
+        class MappedType,
+        class Alloc        = std::allocator<std::pair<KeyType, MappedType>>,
+        class GrowthPolicy = default_growth>
+    class split_darray
+    {
+    private:
+        using _alloc_traits = std::allocator_traits<Alloc>;
+
+        using _key_array    = darray<KeyType,    typename _alloc_traits::template rebind_alloc<KeyType>,    GrowthPolicy>;
+        using _mapped_array = darray<MappedType, typename _alloc_traits::template rebind_alloc<MappedType>, GrowthPolicy>;
+
+    public: //Typedefs
+        using allocator_type  = Alloc;
+        using key_type        = KeyType;
+        using mapped_type     = MappedType;
+        using value_type      = std::pair<KeyType, MappedType>;
+        using reference       = std::pair<const KeyType&, MappedType&>;
+        using const_reference = std::pair<const KeyType&, const MappedType&>;
+        using size_type       = typename _key_array::size_type;
+        using difference_type = typename _key_array::difference_type;
+        using iterator        = _split_iterator<KeyType, MappedType>;
+        using const_iterator  = _split_iterator<KeyType, const MappedType>;
+
+    public: //Constructors
+        constexpr split_darray() = default;
+
+        constexpr explicit split_darray(const allocator_type& alloc) :
+            _keys(typename _key_array::allocator_type(alloc)),
+            _mapped(typename _mapped_array::allocator_type(alloc)) {}
+
+        constexpr split_darray(const split_darray&) = default;
+        constexpr split_darray(split_darray&&)      = default;
+
+        constexpr split_darray& operator=(const split_darray&) = default;
+        constexpr split_darray& operator=(split_darray&&)      = default;
+
+    public: //Structure of arrays access
+        [[nodiscard]] constexpr const key_type* keys() const noexcept
+        {
+            return std::to_address(_keys.begin());
+        }
+
+        [[nodiscard]] constexpr mapped_type* mapped() noexcept
+        {
+            return std::to_address(_mapped.begin());
+        }
+
+        [[nodiscard]] constexpr const mapped_type* mapped() const noexcept
+        {
+            return std::to_address(_mapped.begin());
+        }
+
+    public: //Insertion functions
+        template<class KeyArg, class ... MappedArgs>
+        constexpr iterator emplace(const const_iterator at, KeyArg&& key, MappedArgs&& ... args)
+        {
+            const difference_type index = at - cbegin();
+
+            _keys.emplace(_keys.cbegin() + index, std::forward<KeyArg>(key));
+
+            //Strong guarantee, the key is removed again if the mapped value fails to construct
+            try {
+                _mapped.emplace(_mapped.cbegin() + index, std::forward<MappedArgs>(args)...);
+            }
+            catch (...) {
+                _keys.erase(_keys.cbegin() + index);
+                throw;
+            }
+
+            return begin() + index;
+        }
+
+        template<class KeyArg, class ... MappedArgs>
+        constexpr iterator emplace_back(KeyArg&& key, MappedArgs&& ... args)
+        {
+            return emplace(cend(), std::forward<KeyArg>(key), std::forward<MappedArgs>(args)...);
+        }
+
+        constexpr void push_back(const value_type& value)
+        {
+            emplace_back(value.first, value.second);
+        }
+
+        constexpr void push_back(value_type&& value)
+        {
+            emplace_back(std::move(value.first), std::move(value.second));
+        }
+
+    public: //Erasion functions
+        constexpr iterator erase(const const_iterator at)
+        {
+            EXPU_VERIFY_DEBUG(at != cend(), "Cannot erase the end iterator.");
+
+            const difference_type index = at - cbegin();
+
+            _keys.erase(_keys.cbegin() + index);
+            _mapped.erase(_mapped.cbegin() + index);
+
+            return begin() + index;
+        }
+
+        //Erases the element at, filling its place with the last element. Constant time, but does not preserve order.
+        constexpr iterator erase_unordered(const const_iterator at)
+        {
+            const difference_type index = at - cbegin();
+
+            _keys.erase_unordered(_keys.cbegin() + index);
+            _mapped.erase_unordered(_mapped.cbegin() + index);
+
+            return begin() + index;
+        }
+
+        constexpr void clear() noexcept
+        {
+            _keys.erase(_keys.cbegin(), _keys.cend());
+            _mapped.erase(_mapped.cbegin(), _mapped.cend());
+        }
+
+    public: //Capacity functions
+        constexpr void reserve(const size_type size)
+        {
+            _keys.reserve(size);
+            _mapped.reserve(size);
+        }
+
+    public: //Comparison operators
+        [[nodiscard]] constexpr bool operator==(const split_darray& other) const
+        {
+            return
+                std::equal(_keys.begin(),   _keys.end(),   other._keys.begin(),   other._keys.end()) &&
+                std::equal(_mapped.begin(), _mapped.end(), other._mapped.begin(), other._mapped.end());
+        }
+
+    public:
+        constexpr void swap(split_darray& other) noexcept
+        {
+            std::swap(_keys,   other._keys);
+            std::swap(_mapped, other._mapped);
+        }
+
+    public: //Size getters
+        [[nodiscard]] constexpr size_type size()     const noexcept { return _keys.size(); }
+        [[nodiscard]] constexpr size_type capacity() const noexcept { return std::min(_keys.capacity(), _mapped.capacity()); }
+        [[nodiscard]] constexpr bool      empty()    const noexcept { return _keys.empty(); }
+
+        [[nodiscard]] constexpr size_type max_size() const noexcept
+        {
+            return std::min(
+                std::allocator_traits<typename _key_array::allocator_type>::max_size(_keys.get_allocator()),
+                std::allocator_traits<typename _mapped_array::allocator_type>::max_size(_mapped.get_allocator()));
+        }
+
+    public: //Iterator getters
+        [[nodiscard]] constexpr iterator begin() noexcept { return iterator(keys(), mapped()); }
+        [[nodiscard]] constexpr iterator end()   noexcept { return begin() + size(); }
+
+        [[nodiscard]] constexpr const_iterator begin()  const noexcept { return cbegin(); }
+        [[nodiscard]] constexpr const_iterator end()    const noexcept { return cend();   }
+        [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return const_iterator(keys(), mapped()); }
+        [[nodiscard]] constexpr const_iterator cend()   const noexcept { return cbegin() + size(); }
+
+    private:
+        _key_array    _keys;
+        _mapped_array _mapped;
+    };
+
+    template<template_of<split_darray> SplitDarray>
+    constexpr void swap(SplitDarray& lhs, SplitDarray& rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+}
+
+#endif // !EXPU_CONTAINERS_SPLIT_DARRAY_HPP_INCLUDED
@@ -0,0 +1,178 @@
+#ifndef EXPU_CONTAINERS_SPSC_RING_HPP_INCLUDED
+#define EXPU_CONTAINERS_SPSC_RING_HPP_INCLUDED
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <limits>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+#include "expu/containers/fixed_array.hpp"
+
+#include "expu/debug.hpp"
+#include "expu/mem_utils.hpp"
+
+namespace expu {
+
+    //////////////////////////////////////SPSC RING///////////////////////////////////////////////////////////////////////////////
+
+
+    //Bounded, lock-free, single producer single consumer ring buffer. Rather than pushing element by element, either
+    //side acquires a contiguous span of the ring to write or read in place, then commits or releases it in one step.
+    //Each side caches the other's index, so only touches the other's cache line once its cached view is exhausted.
+    //Note: Capacity is rounded up to a power of two. Elements are bytes to be overwritten, hence trivially copyable.
+    template<class Type, class Alloc = std::allocator<Type>>
+    class alignas(_cache_line_size) spsc_ring
+    {
+    private:
+        using _storage_type = fixed_array<Type, Alloc>;
+
+        static_assert(std::is_trivially_copyable_v<Type> && std::is_default_constructible_v<Type>,
+            "spsc_ring requires trivially copyable, default constructible types.");
+        static_assert(!std::is_same_v<Type, bool>, "spsc_ring cannot provide spans of packed bools.");
+
+    public: //Typedefs
+        using allocator_type  = Alloc;
+        using value_type      = Type;
+        using size_type       = typename _storage_type::size_type;
+        using difference_type = typename _storage_type::difference_type;
+
+    public: //Constructors
+        explicit spsc_ring(const size_type capacity, const Alloc& alloc = Alloc()) :
+            _elements(std::bit_ceil(std::max(capacity, size_type(1))), Type(), alloc),
+            _mask(_elements.size() - 1) {}
+
+        spsc_ring(const spsc_ring&)            = delete;
+        spsc_ring& operator=(const spsc_ring&) = delete;
+
+    public: //Producer functions
+        //Returns the free span, of at most n elements, starting at the write position. It may be shorter than the free
+        //space when the ring wraps around, and is empty when full. Nothing is visible to the consumer until committed.
+        [[nodiscard]] std::span<Type> acquire_write(const size_type n = std::numeric_limits<size_type>::max()) noexcept
+        {
+            const size_type tail = _tail.load(std::memory_order_relaxed);
+
+            if (_free(tail) < std::min(n, capacity()))
+                _cached_head = _head.load(std::memory_order_acquire);
+
+            return { _data() + (tail & _mask), _contiguous(tail, _free(tail), n) };
+        }
+
+        //Publishes the first n elements of the last acquired write span.
+        void commit_write(const size_type n) noexcept
+        {
+            const size_type tail = _tail.load(std::memory_order_relaxed);
+            EXPU_VERIFY_DEBUG(n <= _free(tail), "Cannot commit more elements than were acquired.");
+
+            _tail.store(tail + n, std::memory_order_release);
+        }
+
+        //Copies up to n elements of [first, first + n) in to the ring, wrapping around its end. Returns how many.
+        size_type try_write(const Type* const first, const size_type n) noexcept
+        {
+            const size_type tail = _tail.load(std::memory_order_relaxed);
+
+            if (_free(tail) < n)
+                _cached_head = _head.load(std::memory_order_acquire);
+
+            const size_type count = std::min(n, _free(tail));
+            const size_type split = std::min(count, capacity() - (tail & _mask));
+
+            _range_memcpy(first,         first + split, _data() + (tail & _mask));
+            _range_memcpy(first + split, first + count, _data());
+
+            _tail.store(tail + count, std::memory_order_release);
+            return count;
+        }
+
+    public: //Consumer functions
+        //Returns the committed span, of at most n elements, starting at the read position. It may be shorter than the
+        //committed elements when the ring wraps around, and is empty when empty. Elements may be modified in place.
+        [[nodiscard]] std::span<Type> acquire_read(const size_type n = std::numeric_limits<size_type>::max()) noexcept
+        {
+            const size_type head = _head.load(std::memory_order_relaxed);
+
+            if (_committed(head) < std::min(n, capacity()))
+                _cached_tail = _tail.load(std::memory_order_acquire);
+
+            return { _data() + (head & _mask), _contiguous(head, _committed(head), n) };
+        }
+
+        //Returns the first n elements of the last acquired read span to the producer.
+        void release_read(const size_type n) noexcept
+        {
+            const size_type head = _head.load(std::memory_order_relaxed);
+            EXPU_VERIFY_DEBUG(n <= _committed(head), "Cannot release more elements than were acquired.");
+
+            _head.store(head + n, std::memory_order_release);
+        }
+
+        //Copies up to n elements out of the ring in to out, wrapping around its end. Returns how many.
+        size_type try_read(Type* const out, const size_type n) noexcept
+        {
+            const size_type head = _head.load(std::memory_order_relaxed);
+
+            if (_committed(head) < n)
+                _cached_tail = _tail.load(std::memory_order_acquire);
+
+            const size_type count = std::min(n, _committed(head));
+            const size_type split = std::min(count, capacity() - (head & _mask));
+
+            const Type* const data = _data();
+            _range_memcpy(data + (head & _mask), data + (head & _mask) + split, out);
+            _range_memcpy(data, data + (count - split), out + split);
+
+            _head.store(head + count, std::memory_order_release);
+            return count;
+        }
+
+    public: //Size getters
+        [[nodiscard]] size_type capacity() const noexcept { return _mask + 1; }
+
+        //Note: Only a snapshot, the other side may write or read concurrently
+        [[nodiscard]] size_type size_approx() const noexcept
+        {
+            const size_type head = _head.load(std::memory_order_relaxed);
+            const size_type tail = _tail.load(std::memory_order_relaxed);
+
+            return std::min(static_cast<size_type>(tail - head), capacity());
+        }
+
+    private:
+        [[nodiscard]] Type* _data() noexcept { return std::to_address(_elements.begin()); }
+
+        //As seen by the producer
+        [[nodiscard]] size_type _free(const size_type tail) const noexcept
+        {
+            return capacity() - static_cast<size_type>(tail - _cached_head);
+        }
+
+        //As seen by the consumer
+        [[nodiscard]] size_type _committed(const size_type head) const noexcept
+        {
+            return static_cast<size_type>(_cached_tail - head);
+        }
+
+        //Elements available from pos before the ring wraps around, limited to n
+        [[nodiscard]] size_type _contiguous(const size_type pos, const size_type available, const size_type n) const noexcept
+        {
+            return std::min({ available, capacity() - (pos & _mask), n });
+        }
+
+    private:
+        _storage_type _elements;
+        size_type     _mask;
+
+        //Written by the producer, alongside its view of the head
+        alignas(_cache_line_size) std::atomic<size_type> _tail = 0;
+        size_type                                        _cached_head = 0;
+
+        //Written by the consumer, alongside its view of the tail
+        alignas(_cache_line_size) std::atomic<size_type> _head = 0;
+        size_type                                        _cached_tail = 0;
+    };
+}
+
+#endif // !EXPU_CONTAINERS_SPSC_RING_HPP_INCLUDED
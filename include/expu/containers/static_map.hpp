@@ -0,0 +1,325 @@
+#ifndef EXPU_CONTAINERS_STATIC_MAP_HPP_INCLUDED
+#define EXPU_CONTAINERS_STATIC_MAP_HPP_INCLUDED
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "expu/maths/basic_maths.hpp"
+
+namespace expu {
+
+    //////////////////////////////////////STATIC HASH///////////////////////////////////////////////////////////////////////////////
+
+
+    //Seeded hash usable in constant expressions, unlike std::hash.
+    //Strings of any type convertible to std::string_view hash alike, hence lookups may use any of them.
+    struct static_hash
+    {
+        using is_transparent = void;
+
+        template<class KeyType>
+        requires(std::is_integral_v<KeyType> || std::is_enum_v<KeyType>)
+        [[nodiscard]] constexpr uint64_t operator()(const KeyType key, const uint64_t seed) const noexcept
+        {
+            uint64_t bits;
+            if constexpr (std::is_enum_v<KeyType>)
+                bits = static_cast<uint64_t>(static_cast<std::underlying_type_t<KeyType>>(key));
+            else
+                bits = static_cast<uint64_t>(key);
+
+            return _mix_hash(bits ^ _mix_hash(seed + 0x9E3779B97F4A7C15));
+        }
+
+        //Consumes 8 bytes per multiply, the seed being folded into the initial state
+        [[nodiscard]] constexpr uint64_t operator()(const std::string_view key, const uint64_t seed) const noexcept
+        {
+            uint64_t hash = _mix_hash(seed + 0x9E3779B97F4A7C15) ^ key.size();
+
+            const size_t size  = key.size();
+            size_t       index = 0;
+
+            for (; index + 8 <= size; index += 8)
+                hash = _combine(hash, _load<8>(key, index));
+
+            //Note: Tails are read with fixed size loads, overlapping when 4 to 7 bytes remain
+            const size_t remaining = size - index;
+
+            if (remaining >= 4)
+                hash = _combine(hash, (_load<4>(key, index) << 32) | _load<4>(key, size - 4));
+            else if (remaining != 0)
+                hash = _combine(hash,
+                    (_load<1>(key, index) << 16) | (_load<1>(key, index + remaining / 2) << 8) | _load<1>(key, size - 1));
+
+            return _mix_hash(hash);
+        }
+
+    private:
+        //Little endian regardless of platform, so hashes computed at compile time match those at runtime
+        template<size_t Count>
+        [[nodiscard]] static constexpr uint64_t _load(const std::string_view key, const size_t index) noexcept
+        {
+            if constexpr (std::endian::native == std::endian::little) {
+                if (!std::is_constant_evaluated()) {
+                    std::conditional_t<Count == 8, uint64_t, std::conditional_t<Count == 4, uint32_t, uint8_t>> word;
+                    std::memcpy(&word, key.data() + index, Count);
+                    return word;
+                }
+            }
+
+            uint64_t word = 0;
+            for (size_t byte = 0; byte != Count; ++byte)
+                word |= static_cast<uint64_t>(static_cast<unsigned char>(key[index + byte])) << (8 * byte);
+
+            return word;
+        }
+
+        [[nodiscard]] static constexpr uint64_t _combine(uint64_t hash, const uint64_t word) noexcept
+        {
+            hash  = (hash ^ word) * 0x9E3779B97F4A7C15;
+            hash ^= hash >> 32;
+
+            return hash;
+        }
+    };
+
+
+    //////////////////////////////////////STATIC MAP///////////////////////////////////////////////////////////////////////////////
+
+
+    //Immutable map whose keys are placed by a minimal perfect hash, computed when constructed (at compile time if constexpr).
+    //Lookups hash once and compare a single slot.
+    //Note: The hash follows CHD/PTHash; keys are split into buckets, then each bucket searches for a pilot value that
+    //displaces all of its keys into free slots. Buckets are placed largest first, as those are hardest to fit.
+    template<
+        class KeyType,
+        class MappedType,
+        size_t Size,
+        class Hash     = static_hash,
+        class KeyEqual = std::equal_to<>>
+    class static_map
+    {
+    public: //Typedefs
+        using key_type        = KeyType;
+        using mapped_type     = MappedType;
+        using value_type      = std::pair<KeyType, MappedType>;
+        using hasher          = Hash;
+        using key_equal       = KeyEqual;
+        using size_type       = size_t;
+        using difference_type = ptrdiff_t;
+        using iterator        = const value_type*;
+        using const_iterator  = const value_type*;
+
+    private:
+        //Note: Two keys per bucket on average, trading a larger pilot table for a quick search
+        static constexpr size_t _bucket_count = Size / 2 + 1;
+
+        static constexpr uint64_t _max_seed_attempts = 64;
+        static constexpr uint64_t _max_pilot         = 64 * static_cast<uint64_t>(Size) + 64;
+
+        static_assert(Size != 0, "expu::static_map must contain at least one element.");
+
+        static constexpr bool _is_transparent = requires {
+            typename Hash::is_transparent;
+            typename KeyEqual::is_transparent;
+        };
+
+    public: //Constructors
+        //Throws std::invalid_argument if keys repeat
+        constexpr explicit static_map(const value_type (&values)[Size])
+        {
+            for (uint64_t seed = 0; seed != _max_seed_attempts; ++seed)
+                if (_try_build(values, seed))
+                    return;
+
+            throw std::invalid_argument("expu::static_map failed to find a perfect hash for its keys.");
+        }
+
+    public: //Lookup functions
+        [[nodiscard]] constexpr const_iterator find(const key_type& key) const
+        {
+            return _find(key);
+        }
+
+        template<class LookupKey>
+        requires _is_transparent
+        [[nodiscard]] constexpr const_iterator find(const LookupKey& key) const
+        {
+            return _find(key);
+        }
+
+        [[nodiscard]] constexpr bool contains(const key_type& key) const
+        {
+            return _find(key) != end();
+        }
+
+        template<class LookupKey>
+        requires _is_transparent
+        [[nodiscard]] constexpr bool contains(const LookupKey& key) const
+        {
+            return _find(key) != end();
+        }
+
+        [[nodiscard]] constexpr const mapped_type& at(const key_type& key) const
+        {
+            return _at(key);
+        }
+
+        template<class LookupKey>
+        requires _is_transparent
+        [[nodiscard]] constexpr const mapped_type& at(const LookupKey& key) const
+        {
+            return _at(key);
+        }
+
+    public: //Size getters
+        [[nodiscard]] static constexpr size_type size()     noexcept { return Size; }
+        [[nodiscard]] static constexpr size_type max_size() noexcept { return Size; }
+        [[nodiscard]] static constexpr bool      empty()    noexcept { return false; }
+
+    public: //Iterator getters
+        //Note: Elements are in slot order, not the order given on construction
+        [[nodiscard]] constexpr const_iterator begin()  const noexcept { return _slots.data(); }
+        [[nodiscard]] constexpr const_iterator end()    const noexcept { return _slots.data() + Size; }
+        [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return begin(); }
+        [[nodiscard]] constexpr const_iterator cend()   const noexcept { return end(); }
+
+    private:
+        [[nodiscard]] static constexpr size_t _bucket_of(const uint64_t hash) noexcept
+        {
+            return static_cast<size_t>((hash >> 32) % _bucket_count);
+        }
+
+        [[nodiscard]] static constexpr size_t _slot_of(const uint64_t hash, const uint64_t displacement) noexcept
+        {
+            return static_cast<size_t>((hash ^ displacement) % Size);
+        }
+
+        template<class LookupKey>
+        [[nodiscard]] constexpr const_iterator _find(const LookupKey& key) const
+        {
+            const uint64_t hash = hasher()(key, _seed);
+            const size_t   slot = _slot_of(hash, _displacements[_bucket_of(hash)]);
+
+            return key_equal()(_slots[slot].first, key) ? begin() + slot : end();
+        }
+
+        template<class LookupKey>
+        [[nodiscard]] constexpr const mapped_type& _at(const LookupKey& key) const
+        {
+            const const_iterator loc = _find(key);
+
+            if (loc == end())
+                throw std::out_of_range("Key not found!");
+            else
+                return loc->second;
+        }
+
+        //Returns false if some bucket found no pilot with this seed, which happens when distinct keys hash alike.
+        constexpr bool _try_build(const value_type (&values)[Size], const uint64_t seed)
+        {
+            std::array<uint64_t, Size> hashes{};
+
+            //Groups value indices by bucket (counting sort)
+            std::array<size_t, _bucket_count + 1> bucket_starts{};
+            for (size_t index = 0; index != Size; ++index) {
+                hashes[index] = hasher()(values[index].first, seed);
+                ++bucket_starts[_bucket_of(hashes[index]) + 1];
+            }
+
+            std::partial_sum(bucket_starts.begin(), bucket_starts.end(), bucket_starts.begin());
+
+            std::array<size_t, Size> by_bucket{};
+            {
+                std::array<size_t, _bucket_count> cursors{};
+                std::copy_n(bucket_starts.begin(), _bucket_count, cursors.begin());
+
+                for (size_t index = 0; index != Size; ++index)
+                    by_bucket[cursors[_bucket_of(hashes[index])]++] = index;
+            }
+
+            const auto bucket_size = [&bucket_starts](const size_t bucket) {
+                return bucket_starts[bucket + 1] - bucket_starts[bucket];
+            };
+
+            std::array<size_t, _bucket_count> bucket_order{};
+            std::iota(bucket_order.begin(), bucket_order.end(), size_t(0));
+            std::sort(bucket_order.begin(), bucket_order.end(), [&bucket_size](const size_t lhs, const size_t rhs) {
+                return bucket_size(lhs) > bucket_size(rhs);
+            });
+
+            std::array<bool, Size> taken{};
+
+            for (const size_t bucket : bucket_order) {
+                const size_t first = bucket_starts[bucket];
+                const size_t last  = bucket_starts[bucket + 1];
+
+                //Remaining buckets are all empty
+                if (first == last)
+                    break;
+
+                for (size_t lhs = first; lhs != last; ++lhs)
+                    for (size_t rhs = lhs + 1; rhs != last; ++rhs)
+                        if (key_equal()(values[by_bucket[lhs]].first, values[by_bucket[rhs]].first))
+                            throw std::invalid_argument("expu::static_map keys must be unique.");
+
+                uint64_t pilot = 0;
+                for (; pilot != _max_pilot; ++pilot) {
+                    const uint64_t displacement = _mix_hash(pilot);
+
+                    size_t placed = first;
+                    for (; placed != last; ++placed) {
+                        const size_t slot = _slot_of(hashes[by_bucket[placed]], displacement);
+
+                        if (taken[slot])
+                            break;
+
+                        taken[slot] = true;
+                    }
+
+                    if (placed == last)
+                        break;
+
+                    for (size_t undo = first; undo != placed; ++undo)
+                        taken[_slot_of(hashes[by_bucket[undo]], displacement)] = false;
+                }
+
+                if (pilot == _max_pilot)
+                    return false;
+
+                _displacements[bucket] = _mix_hash(pilot);
+            }
+
+            for (size_t index = 0; index != Size; ++index)
+                _slots[_slot_of(hashes[index], _displacements[_bucket_of(hashes[index])])] = values[index];
+
+            _seed = seed;
+            return true;
+        }
+
+    private:
+        std::array<value_type, Size>          _slots         = {};
+        std::array<uint64_t, _bucket_count>  _displacements = {}; //Mixed pilot of each bucket
+        uint64_t                              _seed          = 0;
+    };
+
+    template<class KeyType, class MappedType, size_t Size>
+    static_map(const std::pair<KeyType, MappedType>(&)[Size]) -> static_map<KeyType, MappedType, Size>;
+
+    //Deduces the number of elements, e.g. make_static_map<int, std::string_view>({ { 1, "one" }, { 2, "two" } })
+    template<class KeyType, class MappedType, size_t Size>
+    [[nodiscard]] constexpr auto make_static_map(const std::pair<KeyType, MappedType>(&values)[Size])
+    {
+        return static_map<KeyType, MappedType, Size>(values);
+    }
+}
+
+#endif // !EXPU_CONTAINERS_STATIC_MAP_HPP_INCLUDED
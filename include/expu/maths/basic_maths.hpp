@@ -2,6 +2,7 @@
 #define EXPU_BASIC_MATHS_HPP_INCLUDED
 
 #include <concepts>
+#include <cstdint>
 
 #ifdef _MSC_VER
 #include <intrin.h>
@@ -49,7 +50,7 @@ namespace expu {
         return static_cast<unsigned char>(result);
 
 #elif defined __GNUC__
-        static constexpr int _type_bit_count = (sizeof(Type) << 3) - 1;
+        constexpr int _type_bit_count = (sizeof(Type) << 3) - 1;
 
         if constexpr (std::is_same_v<Type, unsigned long long int>)
             return _type_bit_count - __builtin_clzll(value);
@@ -67,6 +68,18 @@ namespace expu {
 
 #endif // _MSVC
     }
+
+    //Finalisation step of MurmurHash3, spreading entropy of weak hashes (e.g. std::hash of integers) across all bits.
+    [[nodiscard]] constexpr uint64_t _mix_hash(uint64_t hash) noexcept
+    {
+        hash ^= hash >> 33;
+        hash *= 0xFF51AFD7ED558CCD;
+        hash ^= hash >> 33;
+        hash *= 0xC4CEB9FE1A85EC53;
+        hash ^= hash >> 33;
+
+        return hash;
+    }
 }
 
 #endif // !EXPU_BASIC_MATHS_HPP_INCLUDED
\ No newline at end of file
@@ -3,17 +3,46 @@
 
 #include <type_traits> //For access to is_nothrow_x, is_trivially_x, etc traits
 #include <iterator>    //For access to iterator_traits and iterator concepts
-#include <memory>      //For access to memcpy and memmove
+#include <memory>      //For access to allocator_traits and to_address
+#include <cstring>     //For access to memcpy, memmove and memset
+#include <algorithm>   //For access to min
+#include <cstdint>     //For access to fixed width integer types
+#include <concepts>    //For access to same_as
+#include <thread>      //For access to thread and hardware_concurrency
+#include <vector>      //For access to vector, holding worker threads
 
 #include "expu/maths/basic_maths.hpp"
 
 #include "expu/meta/meta_utils.hpp"
 
+#if defined(__AVX2__)
+    #define EXPU_HAS_AVX2 1
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define EXPU_HAS_SSE2 1
+#endif
+
+//Relocations of at least this many bytes bypass the cache, see _range_stream_copy. Defaults to 32MiB, roughly the
+//size of a last level cache, beyond which a plain copy would evict the whole cache anyway.
+#ifndef EXPU_STREAM_COPY_THRESHOLD
+#define EXPU_STREAM_COPY_THRESHOLD (size_t(1) << 25)
+#endif
+
+#if defined(EXPU_HAS_AVX2)
+    #include <immintrin.h> //For access to AVX2 and SSE2 intrinsics
+#elif defined(EXPU_HAS_SSE2)
+    #include <emmintrin.h> //For access to SSE2 intrinsics
+#endif
+
 namespace expu {
 
     struct zero_then_variadic{};
     struct one_then_variadic{};
 
+    //Note: std::hardware_destructive_interference_size is avoided as its value may differ between translation units
+    inline constexpr size_t _cache_line_size = 64;
+
     
     //////////////////////////////////////COMPRESSED PAIR ///////////////////////////////////////////////////////////////////////////////
 
@@ -147,6 +176,71 @@ namespace expu {
     }
 
 
+    //////////////////////////////////////ALLOCATOR EXTENSION HELPERS///////////////////////////////////////////////////////////////////////////////
+
+
+    //Optional allocator extension: grows the allocation at ptr, from old_n to new_n elements, without moving it.
+    template<class Alloc>
+    concept _allocator_can_expand = requires(Alloc& alloc, const _alloc_ptr_t<Alloc> ptr, const _alloc_size_t<Alloc> n) {
+        { alloc.try_expand(ptr, n, n) } -> std::convertible_to<bool>;
+    };
+
+    //Optional allocator extension: resizes the allocation at ptr, from old_n to new_n elements, possibly moving
+    //its bytes to a new address. Note: Only viable for trivially relocatable types.
+    template<class Alloc>
+    concept _allocator_can_reallocate = requires(Alloc& alloc, const _alloc_ptr_t<Alloc> ptr, const _alloc_size_t<Alloc> n) {
+        { alloc.try_reallocate(ptr, n, n) } -> std::convertible_to<_alloc_ptr_t<Alloc>>;
+    };
+
+    //Returns true if the allocation was expanded in place. Always false if Alloc does not provide try_expand.
+    template<class Alloc>
+    constexpr bool allocator_try_expand(Alloc& alloc, const _alloc_ptr_t<Alloc> ptr, const _alloc_size_t<Alloc> old_n, const _alloc_size_t<Alloc> new_n)
+        noexcept
+    {
+        if constexpr (_allocator_can_expand<Alloc>)
+            return alloc.try_expand(ptr, old_n, new_n);
+        else
+            return false;
+    }
+
+    //Returns the address of the resized allocation, invalidating ptr, or nullptr on failure (ptr is left untouched).
+    //Always fails if Alloc does not provide try_reallocate.
+    template<class Alloc>
+    constexpr _alloc_ptr_t<Alloc> allocator_try_reallocate(Alloc& alloc, const _alloc_ptr_t<Alloc> ptr, const _alloc_size_t<Alloc> old_n, const _alloc_size_t<Alloc> new_n)
+        noexcept
+    {
+        if constexpr (_allocator_can_reallocate<Alloc>)
+            return alloc.try_reallocate(ptr, old_n, new_n);
+        else
+            return nullptr;
+    }
+
+    //Optional allocator extension: informs the allocator that n elements of storage at ptr, which it did not allocate
+    //(e.g. a container's inline buffer), will be used to construct objects via it until released.
+    template<class Alloc>
+    concept _allocator_can_adopt = requires(Alloc& alloc, const _alloc_ptr_t<Alloc> ptr, const _alloc_size_t<Alloc> n) {
+        alloc.adopt(ptr, n);
+        alloc.release(ptr, n);
+    };
+
+    template<class Alloc>
+    constexpr void allocator_adopt(Alloc& alloc, const _alloc_ptr_t<Alloc> ptr, const _alloc_size_t<Alloc> n)
+        noexcept
+    {
+        if constexpr (_allocator_can_adopt<Alloc>)
+            alloc.adopt(ptr, n);
+    }
+
+    //Reverses allocator_adopt. All objects in the storage must have been destroyed beforehand.
+    template<class Alloc>
+    constexpr void allocator_release(Alloc& alloc, const _alloc_ptr_t<Alloc> ptr, const _alloc_size_t<Alloc> n)
+        noexcept
+    {
+        if constexpr (_allocator_can_adopt<Alloc>)
+            alloc.release(ptr, n);
+    }
+
+
     //////////////////////////////////////HELPER EXPECTION HANDLING FUNCTIONS//////////////////////////////////////////////////////////////////
 
 
@@ -379,6 +473,176 @@ namespace expu {
     inline constexpr _range_memcpy_or_memmove<false> _range_memmove{_not_quite_object::construct_tag{}};
 
 
+    //Copies size bytes using non-temporal stores, which write around the cache rather than through it. Hence the
+    //destination is not read in beforehand, and neither it nor the source evict the rest of the cache.
+    //Note: Ranges must not overlap. Falls back to memcpy without SSE2.
+    inline void* _stream_memcpy(void* const dest, const void* const src, const size_t size) noexcept
+    {
+#if defined(EXPU_HAS_SSE2)
+    #if defined(EXPU_HAS_AVX2)
+        constexpr size_t alignment = 32;
+    #else
+        constexpr size_t alignment = 16;
+    #endif
+
+        char*       output = static_cast<char*>(dest);
+        const char* input  = static_cast<const char*>(src);
+        char* const last   = output + size;
+
+        //Non-temporal stores must be aligned, hence copy up to the first aligned address normally
+        const size_t head = std::min(size, (alignment - reinterpret_cast<uintptr_t>(output) % alignment) % alignment);
+        std::memcpy(output, input, head);
+        output += head;
+        input  += head;
+
+    #if defined(EXPU_HAS_AVX2)
+        for (; last - output >= 128; output += 128, input += 128) {
+            const __m256i first  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input));
+            const __m256i second = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + 32));
+            const __m256i third  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + 64));
+            const __m256i fourth = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + 96));
+
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(output),      first);
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(output + 32), second);
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(output + 64), third);
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(output + 96), fourth);
+        }
+    #endif
+
+        for (; last - output >= 16; output += 16, input += 16)
+            _mm_stream_si128(reinterpret_cast<__m128i*>(output), _mm_loadu_si128(reinterpret_cast<const __m128i*>(input)));
+
+        //Note: Non-temporal stores are weakly ordered, hence must be fenced before the memory is handed to others
+        _mm_sfence();
+
+        std::memcpy(output, input, static_cast<size_t>(last - output));
+        return dest;
+#else
+        return std::memcpy(dest, src, size);
+#endif
+    }
+
+    //_range_memcpy, but ranges of at least EXPU_STREAM_COPY_THRESHOLD bytes are copied with non-temporal stores.
+    //Intended for relocation, where the destination is freshly allocated and the source is about to be freed, hence
+    //neither is worth caching.
+    template<
+        std::contiguous_iterator SrcCtgIt,
+        std::sized_sentinel_for<SrcCtgIt> SrcSizedSentinel,
+        std::contiguous_iterator DestCtgIt>
+    DestCtgIt _range_stream_copy(SrcCtgIt first, SrcSizedSentinel last, DestCtgIt output) noexcept
+    {
+        const auto count = static_cast<size_t>(last - first);
+        const size_t size = count * sizeof(std::iter_value_t<SrcCtgIt>);
+
+        if (size < EXPU_STREAM_COPY_THRESHOLD)
+            return _range_memcpy(first, last, output);
+
+        _stream_memcpy(std::to_address(output), std::to_address(first), size);
+        return output + count;
+    }
+
+
+    //////////////////////////////////////EXECUTION POLICIES///////////////////////////////////////////////////////////////////////////////
+
+
+    //Mirror std::execution::seq and std::execution::par, without requiring a parallel backend (e.g. TBB).
+    struct sequenced_policy {};
+
+    //Trivial copies of at least min_parallel_bytes are split in to chunks, copied by up to max_threads threads (zero
+    //for one per hardware thread) including the calling one. Smaller copies do not amortise starting the threads.
+    struct parallel_policy
+    {
+        size_t   min_parallel_bytes = size_t(1) << 24;
+        unsigned max_threads        = 0;
+    };
+
+    inline constexpr sequenced_policy seq{};
+    inline constexpr parallel_policy  par{};
+
+    template<class Policy>
+    concept execution_policy =
+        std::same_as<std::remove_cvref_t<Policy>, sequenced_policy> ||
+        std::same_as<std::remove_cvref_t<Policy>, parallel_policy>;
+
+    //Copies size bytes in page aligned chunks, one per thread. Chunks whose thread fails to start are instead
+    //copied by the calling thread. If stream is set, chunks are copied with non-temporal stores (see _stream_memcpy).
+    //Note: Ranges must not overlap.
+    inline void* _parallel_memcpy(void* const dest, const void* const src, const size_t size, const parallel_policy& policy, const bool stream = false) noexcept
+    {
+        const auto memcpy_chunk = stream ? &_stream_memcpy : [](void* const chunk_dest, const void* const chunk_src, const size_t chunk_size) noexcept {
+            return std::memcpy(chunk_dest, chunk_src, chunk_size);
+        };
+
+        constexpr size_t chunk_alignment = 4096;
+
+        const size_t max_threads =
+            policy.max_threads ? policy.max_threads : std::max(std::thread::hardware_concurrency(), 1u);
+
+        const size_t thread_count = size < policy.min_parallel_bytes ? 1 : std::min(max_threads, size / chunk_alignment);
+
+        if (thread_count <= 1)
+            return memcpy_chunk(dest, src, size);
+
+        const size_t chunk_size = (size / thread_count + chunk_alignment - 1) & ~(chunk_alignment - 1);
+
+        const auto copy_chunk = [=](const size_t index) noexcept {
+            const size_t offset = index * chunk_size;
+
+            if (offset < size)
+                memcpy_chunk(static_cast<char*>(dest) + offset, static_cast<const char*>(src) + offset, std::min(chunk_size, size - offset));
+        };
+
+        std::vector<std::thread> workers;
+
+        //Note: The calling thread copies the first chunk
+        size_t started = 1;
+        try {
+            workers.reserve(thread_count - 1);
+
+            for (; started != thread_count; ++started)
+                workers.emplace_back(copy_chunk, started);
+        }
+        catch (...) {}
+
+        for (size_t index = started; index != thread_count; ++index)
+            copy_chunk(index);
+
+        copy_chunk(0);
+
+        for (std::thread& worker : workers)
+            worker.join();
+
+        return dest;
+    }
+
+    //_range_memcpy, splitting large ranges across threads as per policy.
+    template<
+        std::contiguous_iterator SrcCtgIt,
+        std::sized_sentinel_for<SrcCtgIt> SrcSizedSentinel,
+        std::contiguous_iterator DestCtgIt>
+    DestCtgIt _parallel_range_memcpy(const parallel_policy& policy, SrcCtgIt first, SrcSizedSentinel last, DestCtgIt output) noexcept
+    {
+        const auto count = static_cast<size_t>(last - first);
+
+        _parallel_memcpy(std::to_address(output), std::to_address(first), count * sizeof(std::iter_value_t<SrcCtgIt>), policy);
+        return output + count;
+    }
+
+    //_range_stream_copy, splitting large ranges across threads as per policy.
+    template<
+        std::contiguous_iterator SrcCtgIt,
+        std::sized_sentinel_for<SrcCtgIt> SrcSizedSentinel,
+        std::contiguous_iterator DestCtgIt>
+    DestCtgIt _parallel_range_stream_copy(const parallel_policy& policy, SrcCtgIt first, SrcSizedSentinel last, DestCtgIt output) noexcept
+    {
+        const auto count = static_cast<size_t>(last - first);
+        const size_t size = count * sizeof(std::iter_value_t<SrcCtgIt>);
+
+        _parallel_memcpy(std::to_address(output), std::to_address(first), size, policy, EXPU_STREAM_COPY_THRESHOLD <= size);
+        return output + count;
+    }
+
+
     template<bool not_overlapping>
     struct _range_backward_memcpy_or_memmove : private _not_quite_object
     {
@@ -409,36 +673,228 @@ namespace expu {
     inline constexpr _range_backward_memcpy_or_memmove<false> _range_backward_memmove{_not_quite_object::construct_tag{}};  
 
 
-    template<
-        std::contiguous_iterator CtgIt,
-        std::sized_sentinel_for<CtgIt> SizedSentinel>
-    void* set_bits(void* const bits, CtgIt first, const SizedSentinel last)
+
+    //Whether a PatternSize byte pattern can be repeated across a vector register.
+    template<size_t PatternSize>
+    inline constexpr bool _has_vector_pattern_fill =
+#if defined(EXPU_HAS_SSE2)
+        PatternSize <= 16 && 16 % PatternSize == 0;
+#else
+        false;
+#endif
+
+#if defined(EXPU_HAS_SSE2)
+    //Repeats the PatternSize byte pattern across size bytes starting at output using unaligned vector stores.
+    //Note: size must be a multiple of PatternSize.
+    template<size_t PatternSize>
+    void _vector_pattern_fill(char* output, const size_t size, const unsigned char* const pattern) noexcept
+    {
+        alignas(32) unsigned char block[32];
+        for (size_t offset = 0; offset < sizeof(block); offset += PatternSize)
+            std::memcpy(block + offset, pattern, PatternSize);
+
+        char* const last = output + size;
+
+#if defined(EXPU_HAS_AVX2)
+        const __m256i block_256 = _mm256_load_si256(reinterpret_cast<const __m256i*>(block));
+        for (; last - output >= 128; output += 128) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output),      block_256);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + 32), block_256);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + 64), block_256);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + 96), block_256);
+        }
+#endif
+
+        const __m128i block_128 = _mm_load_si128(reinterpret_cast<const __m128i*>(block));
+        for (; last - output >= 16; output += 16)
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output), block_128);
+
+        //Note: Every store above is a multiple of PatternSize, hence the remainder starts at a pattern boundary.
+        std::memcpy(output, block, static_cast<size_t>(last - output));
+    }
+#endif
+
+    //Sets count elements starting at output to the bytes of value. If every byte of value is identical, memset is
+    //used. Patterns of 2, 4, 8 or 16 bytes are repeated using vector stores where available. Otherwise value is
+    //copied once, then the filled range is repeatedly doubled using memcpy.
+    //Note: value must be bitwise assignable to output's type.
+    template<class Type, class DestType>
+    DestType* _range_fill(DestType* const output, const size_t count, const Type& value) noexcept
+    {
+        static_assert(std::is_trivially_copyable_v<Type> && sizeof(Type) == sizeof(DestType));
+
+        if (count == 0)
+            return output;
+
+        auto output_chr = const_cast<char*>(reinterpret_cast<const volatile char*>(output));
+
+        unsigned char bytes[sizeof(Type)];
+        std::memcpy(bytes, std::addressof(value), sizeof(Type));
+
+        bool is_splat = true;
+        for (size_t index = 1; index < sizeof(Type); ++index)
+            is_splat &= (bytes[index] == bytes[0]);
+
+        const size_t size = count * sizeof(DestType);
+
+        if (is_splat)
+            std::memset(output_chr, bytes[0], size);
+#if defined(EXPU_HAS_SSE2)
+        else if constexpr (_has_vector_pattern_fill<sizeof(Type)>)
+            _vector_pattern_fill<sizeof(Type)>(output_chr, size, bytes);
+#endif
+        else {
+            std::memcpy(output_chr, bytes, sizeof(Type));
+
+            for (size_t filled = sizeof(Type); filled < size; filled <<= 1)
+                std::memcpy(output_chr + filled, output_chr, std::min(filled, size - filled));
+        }
+
+        return output + count;
+    }
+
+
+    //Whether Iter points to contiguous single byte flags, which may be packed directly from their bytes.
+    template<class Iter>
+    inline constexpr bool _is_byte_flag_iterator = false;
+
+    template<std::contiguous_iterator CtgIt>
+    inline constexpr bool _is_byte_flag_iterator<CtgIt> =
+        std::is_integral_v<std::iter_value_t<CtgIt>> && sizeof(std::iter_value_t<CtgIt>) == 1;
+
+    //Packs count byte flags into bits, least significant bit first. Any non-zero flag sets its bit.
+    inline unsigned char* _pack_byte_flags(unsigned char* bits, const unsigned char* flags, size_t count) noexcept
     {
-        const size_t bytes_count = right_shift_round_up(std::ranges::distance(first, last), 3);
+        //Note: movemask results are stored little endian, as is the case for every target providing SSE2.
+#if defined(EXPU_HAS_AVX2)
+        const __m256i zero_256 = _mm256_setzero_si256();
+        for (; count >= 32; count -= 32, flags += 32, bits += 4) {
+            const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(flags));
+            const auto mask = ~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, zero_256)));
+            std::memcpy(bits, &mask, sizeof(mask));
+        }
+#endif
+
+#if defined(EXPU_HAS_SSE2)
+        const __m128i zero_128 = _mm_setzero_si128();
+        for (; count >= 16; count -= 16, flags += 16, bits += 2) {
+            const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(flags));
+            const auto mask = static_cast<uint16_t>(~_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, zero_128)));
+            std::memcpy(bits, &mask, sizeof(mask));
+        }
+#endif
 
-        auto bytes = static_cast<char*>(bits);
+        for (; count != 0; ++bits) {
+            const size_t bit_count = std::min<size_t>(count, 8);
 
-        for (size_t index = 0; index < bytes_count - 1; ++index, ++bytes) {
             unsigned char value = 0;
-            for (unsigned char mask = 1; mask != 0; mask <<= 1, ++first)
-                value |= mask * static_cast<bool>(*first);
+            for (size_t bit = 0; bit < bit_count; ++bit)
+                value |= static_cast<unsigned char>((flags[bit] != 0) << bit);
 
-            std::memset(bytes, value, 1);
+            *bits = value;
+            flags += bit_count;
+            count -= bit_count;
         }
 
-        unsigned char value = 0;
-        for (unsigned char mask = 1; first != last; mask <<= 1, ++first)
-            value |= mask * static_cast<bool>(*first);
+        return bits;
+    }
+
+    //Unpacks count bits into byte flags of either 0 or 1, least significant bit first.
+    inline unsigned char* _unpack_byte_flags(const unsigned char* bits, unsigned char* flags, size_t count) noexcept
+    {
+#if defined(EXPU_HAS_AVX2)
+        //Each byte lane selects the source byte holding its bit, then tests that bit.
+        const __m256i byte_index_256 = _mm256_setr_epi64x(
+            0x0000000000000000, 0x0101010101010101, 0x0202020202020202, 0x0303030303030303);
+        const __m256i bit_mask_256 = _mm256_set1_epi64x(static_cast<long long>(0x8040201008040201));
+        const __m256i one_256 = _mm256_set1_epi8(1);
+
+        for (; count >= 32; count -= 32, bits += 4, flags += 32) {
+            uint32_t word;
+            std::memcpy(&word, bits, sizeof(word));
+
+            const __m256i spread = _mm256_shuffle_epi8(_mm256_set1_epi32(static_cast<int>(word)), byte_index_256);
+            const __m256i is_set = _mm256_cmpeq_epi8(_mm256_and_si256(spread, bit_mask_256), bit_mask_256);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(flags), _mm256_and_si256(is_set, one_256));
+        }
+#endif
 
-        std::memset(bytes, value, 1);
-        return ++bytes;
+#if defined(EXPU_HAS_SSE2)
+        const __m128i bit_mask_128 = _mm_set1_epi64x(static_cast<long long>(0x8040201008040201));
+        const __m128i one_128 = _mm_set1_epi8(1);
+
+        for (; count >= 16; count -= 16, bits += 2, flags += 16) {
+            uint16_t word;
+            std::memcpy(&word, bits, sizeof(word));
+
+            //Note: Unpacking with itself three times repeats each of the two source bytes eight times.
+            __m128i spread = _mm_cvtsi32_si128(word);
+            spread = _mm_unpacklo_epi8(spread, spread);
+            spread = _mm_unpacklo_epi16(spread, spread);
+            spread = _mm_unpacklo_epi32(spread, spread);
+
+            const __m128i is_set = _mm_cmpeq_epi8(_mm_and_si128(spread, bit_mask_128), bit_mask_128);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(flags), _mm_and_si128(is_set, one_128));
+        }
+#endif
+
+        for (size_t index = 0; index < count; ++index)
+            flags[index] = static_cast<unsigned char>((bits[index >> 3] >> (index & 7)) & 1);
+
+        return flags + count;
+    }
+
+    //Packs the truthiness of each element in [first, last) into bits, least significant bit first. Returns
+    //one past the last byte written.
+    template<
+        std::forward_iterator FwdIt,
+        std::sentinel_for<FwdIt> Sentinel>
+    void* set_bits(void* const bits, FwdIt first, const Sentinel last)
+    {
+        auto bytes = static_cast<unsigned char*>(bits);
+
+        if constexpr (_is_byte_flag_iterator<FwdIt> && std::sized_sentinel_for<Sentinel, FwdIt>) {
+            const auto flags = reinterpret_cast<const unsigned char*>(std::to_address(first));
+            return _pack_byte_flags(bytes, flags, static_cast<size_t>(last - first));
+        }
+        else {
+            while (first != last) {
+                unsigned char value = 0;
+                for (unsigned char mask = 1; mask != 0 && first != last; mask <<= 1, ++first)
+                    value |= mask * static_cast<bool>(*first);
+
+                *bytes++ = value;
+            }
+
+            return bytes;
+        }
+    }
+
+    //Writes count bits, least significant bit first, as bools to output. Returns one past the last element written.
+    template<std::weakly_incrementable OutIt>
+    OutIt unpack_bits(const void* const bits, const size_t count, OutIt output)
+    {
+        const auto bytes = static_cast<const unsigned char*>(bits);
+
+        if constexpr (_is_byte_flag_iterator<OutIt>) {
+            const auto flags = reinterpret_cast<unsigned char*>(std::to_address(output));
+            _unpack_byte_flags(bytes, flags, count);
+
+            return output + static_cast<std::iter_difference_t<OutIt>>(count);
+        }
+        else {
+            for (size_t index = 0; index < count; ++index, ++output)
+                *output = static_cast<bool>((bytes[index >> 3] >> (index & 7)) & 1);
+
+            return output;
+        }
     }
 
     template<
         class Alloc,
-        std::contiguous_iterator CtgIt,
-        std::sized_sentinel_for<CtgIt> SizedSentinel> 
-    void* set_bits(Alloc& alloc, void* const bits, CtgIt first, const SizedSentinel last)
+        std::forward_iterator FwdIt,
+        std::sentinel_for<FwdIt> Sentinel>
+    void* set_bits(Alloc& alloc, void* const bits, FwdIt first, const Sentinel last)
     {
         void* const result = set_bits(bits, first, last);
         _mark_initialised_if_checked_allocator(alloc, bits, result, true);
@@ -446,6 +902,18 @@ namespace expu {
         return result;
     }
 
+/////////////////////////////////////RELOCATION TRAITS///////////////////////////////////////////////////////////////////
+
+    //A type is trivially relocatable if moving it to a new address, then destroying the source, is equivalent
+    //to a memcpy which is never followed by a destructor call. Specialise (as std::true_type) to opt-in types
+    //such as those holding a std::unique_ptr. Note: By specialising, relocation of the type must never throw.
+    template<class Type>
+    struct is_trivially_relocatable :
+        std::bool_constant<std::is_trivially_move_constructible_v<Type> && std::is_trivially_destructible_v<Type>> {};
+
+    template<class Type>
+    constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<Type>::value;
+
 /////////////////////////////////////UNINITIALISED RANGE FUNCTIONS///////////////////////////////////////////////////////////////////
 
     template<
@@ -471,6 +939,27 @@ namespace expu {
         return partial_range.release();
     }
 
+    //As above, trivial copies are split across threads under a parallel_policy.
+    template<
+        execution_policy Policy,
+        class Alloc,
+        class Type,
+        std::input_iterator InputIt,
+        std::sentinel_for<InputIt> Sentinel>
+    constexpr auto uninitialised_copy(const Policy& policy, Alloc& alloc, InputIt first, Sentinel last, Type* output)
+        noexcept(std::is_nothrow_constructible_v<Type, std::iter_reference_t<InputIt>>)
+    {
+        if constexpr (std::is_same_v<Policy, parallel_policy> && _actually_trivially<InputIt, Type*, Sentinel>::constructible) {
+            if (!std::is_constant_evaluated()) {
+                Type* const result = _parallel_range_memcpy(policy, _unwrapped(first), _unwrapped(last), output);
+                _mark_initialised_if_checked_allocator(alloc, output, result, true);
+                return result;
+            }
+        }
+
+        return uninitialised_copy(alloc, first, last, output);
+    }
+
     template<
         class Alloc,
         class Type,
@@ -510,30 +999,144 @@ namespace expu {
             output);
     }
 
-    //Todo: memset for compatible types
-    template<class Type, class Alloc, class DestType>
-    constexpr void uninitialised_fill(Alloc& alloc, DestType* first, const DestType* const last, const Type& value)
-        noexcept(std::is_nothrow_constructible_v<DestType, Type>)
+    //Moves [first, last) into the uninitialised range beginning at output, then destroys the source range.
+    //On exception, the source range is left untouched. Note: ranges must not overlap.
+    template<class Alloc, class Type>
+    constexpr Type* uninitialised_relocate(Alloc& alloc, Type* first, Type* last, Type* output)
+        noexcept(is_trivially_relocatable_v<Type> || std::is_nothrow_move_constructible_v<Type>)
     {
-        _partial_range<Alloc, Type> partial_range(alloc, first);
-        for (; first != last; ++first)
-            partial_range.emplace_back(value);
+        if constexpr (is_trivially_relocatable_v<Type>) {
+            if (!std::is_constant_evaluated()) {
+                if (first == last)
+                    return output;
+
+                _mark_initialised_if_checked_allocator(alloc, first, last, false);
+                Type* const result = _range_stream_copy(first, last, output);
+                _mark_initialised_if_checked_allocator(alloc, output, result, true);
+
+                return result;
+            }
+        }
+
+        Type* const result = uninitialised_move(alloc, first, last, output);
+        destroy_range(alloc, first, last);
+
+        return result;
+    }
+
+    //As above, trivially relocatable ranges are split across threads under a parallel_policy.
+    template<execution_policy Policy, class Alloc, class Type>
+    constexpr Type* uninitialised_relocate(const Policy& policy, Alloc& alloc, Type* first, Type* last, Type* output)
+        noexcept(is_trivially_relocatable_v<Type> || std::is_nothrow_move_constructible_v<Type>)
+    {
+        if constexpr (std::is_same_v<Policy, parallel_policy> && is_trivially_relocatable_v<Type>) {
+            if (!std::is_constant_evaluated() && first != last) {
+                _mark_initialised_if_checked_allocator(alloc, first, last, false);
+                Type* const result = _parallel_range_stream_copy(policy, first, last, output);
+                _mark_initialised_if_checked_allocator(alloc, output, result, true);
+
+                return result;
+            }
+        }
+
+        return uninitialised_relocate(alloc, first, last, output);
+    }
+
+    //Overlapping version of uninitialised_relocate, used to shift elements within the same buffer.
+    template<class Alloc, class Type>
+    requires(is_trivially_relocatable_v<Type>)
+    constexpr Type* _uninitialised_relocate_overlapping(Alloc& alloc, Type* first, Type* last, Type* output) noexcept
+    {
+        if (std::is_constant_evaluated()) {
+            //Relocate one at a time, in whichever direction avoids overwriting elements yet to be relocated.
+            if (output < first) {
+                for (; first != last; ++first, ++output) {
+                    std::allocator_traits<Alloc>::construct(alloc, output, std::move(*first));
+                    std::allocator_traits<Alloc>::destroy(alloc, first);
+                }
+
+                return output;
+            }
+
+            Type* const result = output + (last - first);
+            for (Type* dest = result; first != last;) {
+                std::allocator_traits<Alloc>::construct(alloc, --dest, std::move(*(--last)));
+                std::allocator_traits<Alloc>::destroy(alloc, last);
+            }
+
+            return result;
+        }
+
+        if (first == last)
+            return output;
 
-        partial_range.release();
+        //Note: Marking source first ensures overlapping region is never marked twice.
+        _mark_initialised_if_checked_allocator(alloc, first, last, false);
+        Type* const result = _range_memmove(first, last, output);
+        _mark_initialised_if_checked_allocator(alloc, output, result, true);
+
+        return result;
     }
 
-    //Todo: memset for compatible types
     template<class Type, class Alloc, class DestType>
     constexpr auto uninitialised_fill_n(Alloc& alloc, DestType* first, size_t n, const Type& value)
         noexcept(std::is_nothrow_constructible_v<DestType, Type>)
     {
-        _partial_range<Alloc, Type> partial_range(alloc, first);
+        if constexpr (_actually_trivially<const Type*, DestType*>::constructible) {
+            if (!std::is_constant_evaluated()) {
+                DestType* const result = _range_fill(first, n, value);
+                _mark_initialised_if_checked_allocator(alloc, first, result, true);
+                return result;
+            }
+        }
+
+        _partial_range<Alloc, DestType> partial_range(alloc, first);
         while(n--)
             partial_range.emplace_back(value);
 
         return partial_range.release();
     }
 
+    template<class Type, class Alloc, class DestType>
+    constexpr void uninitialised_fill(Alloc& alloc, DestType* first, const DestType* const last, const Type& value)
+        noexcept(std::is_nothrow_constructible_v<DestType, Type>)
+    {
+        uninitialised_fill_n(alloc, first, static_cast<size_t>(last - first), value);
+    }
+
+    //Value-initialises n elements starting at first.
+    template<class Alloc, class Type>
+    constexpr Type* uninitialised_value_construct_n(Alloc& alloc, Type* first, size_t n)
+        noexcept(std::is_nothrow_default_constructible_v<Type>)
+    {
+        //Note: Value-initialised trivial types are all zero, hence can be filled.
+        if constexpr (std::is_trivially_default_constructible_v<Type> && std::is_trivially_copyable_v<Type>)
+            return uninitialised_fill_n(alloc, first, n, Type());
+        else {
+            _partial_range<Alloc, Type> partial_range(alloc, first);
+            while (n--)
+                partial_range.emplace_back();
+
+            return partial_range.release();
+        }
+    }
+
+    //Default-initialises n elements starting at first. That is, trivially default constructible types are left
+    //with indeterminate values.
+    template<class Alloc, class Type>
+    constexpr Type* uninitialised_default_construct_n(Alloc& alloc, Type* first, size_t n)
+        noexcept(std::is_nothrow_default_constructible_v<Type>)
+    {
+        if constexpr (std::is_trivially_default_constructible_v<Type>) {
+            if (!std::is_constant_evaluated()) {
+                _mark_initialised_if_checked_allocator(alloc, first, first + n, true);
+                return first + n;
+            }
+        }
+
+        return uninitialised_value_construct_n(alloc, first, n);
+    }
+
 
 /////////////////////////////////////INITIALISED RANGE FUNCTIONS///////////////////////////////////////////////////////////////////
 
@@ -557,6 +1160,28 @@ namespace expu {
         return output;
     }
 
+    //As above, trivial copies between disjoint ranges are split across threads under a parallel_policy.
+    template<
+        execution_policy Policy,
+        std::input_iterator InputIt,
+        std::sentinel_for<InputIt> Sentinel,
+        _output_iterator_for<InputIt> OutIt>
+    constexpr OutIt copy(const Policy& policy, InputIt first, Sentinel last, OutIt output) {
+        if constexpr (std::is_same_v<Policy, parallel_policy> && _actually_trivially<InputIt, OutIt, Sentinel>::assignable) {
+            if (!std::is_constant_evaluated()) {
+                const auto bytes = static_cast<uintptr_t>(_unwrapped(last) - _unwrapped(first)) * sizeof(std::iter_value_t<OutIt>);
+                const auto src   = reinterpret_cast<uintptr_t>(std::to_address(_unwrapped(first)));
+                const auto dest  = reinterpret_cast<uintptr_t>(std::to_address(output));
+
+                //Note: Overlapping ranges are left to memmove
+                if (dest + bytes <= src || src + bytes <= dest)
+                    return _parallel_range_memcpy(policy, _unwrapped(first), _unwrapped(last), output);
+            }
+        }
+
+        return copy(first, last, output);
+    }
+
     template<
         std::input_iterator InputIt,
         std::sentinel_for<InputIt> Sentinel,
@@ -607,8 +1232,12 @@ namespace expu {
     constexpr InputIt copy_until_sentinel(InputIt first, OutIt out_first, Sentinel out_last)
     {
         if constexpr (_actually_trivially<InputIt, OutIt>::assignable && std::sized_sentinel_for<Sentinel, OutIt>) {
-            if (!std::is_constant_evaluated()) 
-                return _range_memmove(_unwrapped(first), _unwrapped(first) + (out_last - out_first), out_first);
+            if (!std::is_constant_evaluated()) {
+                const auto count = out_last - out_first;
+
+                _range_memmove(_unwrapped(first), _unwrapped(first) + count, out_first);
+                return first + count;
+            }
         }
 
         for (; out_first != out_last; ++first, ++out_first)
@@ -620,13 +1249,15 @@ namespace expu {
     template<
         std::input_iterator InputIt,
         std::sentinel_for<InputIt> Sentinel,
-        class Alloc>
-    [[nodiscard]] constexpr auto _ctg_duplicate(Alloc& alloc, InputIt first, Sentinel last, _alloc_ptr_t<Alloc>& output, _alloc_size_t<Alloc> capacity)
+        class Alloc,
+        execution_policy Policy = sequenced_policy>
+    [[nodiscard]] constexpr auto _ctg_duplicate(
+        Alloc& alloc, InputIt first, Sentinel last, _alloc_ptr_t<Alloc>& output, _alloc_size_t<Alloc> capacity, const Policy& policy = {})
     {
         output = std::allocator_traits<Alloc>::allocate(alloc, capacity);
 
         try {
-            return uninitialised_copy(alloc, first, last, std::to_address(output));
+            return uninitialised_copy(policy, alloc, first, last, std::to_address(output));
         }
         catch (...) {
             std::allocator_traits<Alloc>::deallocate(alloc, output, capacity);
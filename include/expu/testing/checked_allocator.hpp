@@ -226,6 +226,33 @@ namespace expu {
             _allocated_memory->erase(loc);
         }
 
+    public: //Adopt and release (memory not allocated by this allocator, e.g. inline buffers)
+        void adopt(const pointer pointer, const size_type n)
+        {
+            const bool inserted = _allocated_memory->try_emplace(std::to_address(pointer), this, _byte_size(n)).second;
+
+            EXPU_VERIFY(inserted, "Trying to adopt memory which is already tracked!");
+        }
+
+        void release(const pointer pointer, const size_type n)
+        {
+            //Note: Moved-from allocators no longer track any memory
+            if (!_allocated_memory)
+                return;
+
+            auto loc = _allocated_memory->find(std::to_address(pointer));
+
+            EXPU_VERIFY(loc != _allocated_memory->end(), "Trying to release memory which has not been adopted!");
+            EXPU_VERIFY(loc->second.initialised.size() == _byte_size(n), "Partially releasing memory!");
+
+            if constexpr (!std::is_trivially_destructible_v<value_type> || _throw_on_trivial) {
+                for (bool initialised_element : loc->second.initialised)
+                    EXPU_VERIFY(!initialised_element, "Trying to release memory wherein objects have not been destroyed!");
+            }
+
+            _allocated_memory->erase(loc);
+        }
+
     public: //Construction and destruction functions
         template<class Type, class ... Args>
         void construct(Type* const xp, Args&& ... args)
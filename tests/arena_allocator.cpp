@@ -0,0 +1,164 @@
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "expu/allocators/arena_allocator.hpp"
+#include "expu/containers/darray.hpp"
+#include "expu/containers/fixed_array.hpp"
+#include "expu/iterators/seq_iter.hpp"
+
+
+TEST(arena_tests, allocations_are_aligned_and_disjoint)
+{
+    expu::arena arena(256);
+
+    std::vector<std::pair<uintptr_t, size_t>> allocations;
+
+    for (size_t i = 0; i < 1000; ++i) {
+        const size_t bytes     = 1 + (i * 37) % 300;
+        const size_t alignment = size_t(1) << (i % 8);
+
+        const auto address = reinterpret_cast<uintptr_t>(arena.allocate(bytes, alignment));
+        ASSERT_EQ(address % alignment, 0) << "Allocation: " << i;
+
+        //Fill so that any overlap is caught by the sanitizers, or the check below
+        std::memset(reinterpret_cast<void*>(address), static_cast<int>(i), bytes);
+        allocations.emplace_back(address, bytes);
+    }
+
+    std::sort(allocations.begin(), allocations.end());
+    for (size_t i = 1; i < allocations.size(); ++i)
+        ASSERT_LE(allocations[i - 1].first + allocations[i - 1].second, allocations[i].first);
+}
+
+TEST(arena_tests, chunks_grow_and_chain)
+{
+    expu::arena arena(1024, 8192);
+
+    for (int i = 0; i < 100; ++i)
+        (void)arena.allocate(100);
+
+    //Chunks double in size until the maximum: 1024 + 2048 + 4096 + 8192 + ...
+    EXPECT_GT(arena.chunk_count(), 1);
+    EXPECT_GE(arena.capacity(), 100 * 100);
+
+    //Oversized requests are given a chunk of their own
+    const size_t chunks = arena.chunk_count();
+    (void)arena.allocate(1 << 20);
+
+    EXPECT_EQ(arena.chunk_count(), chunks + 1);
+    EXPECT_GE(arena.capacity(), size_t(1) << 20);
+}
+
+TEST(arena_tests, reset_and_release)
+{
+    expu::arena arena(1024);
+
+    for (int i = 0; i < 100; ++i)
+        (void)arena.allocate(100);
+
+    //Reset keeps only the newest chunk, whose memory is then reused
+    arena.reset();
+    EXPECT_EQ(arena.chunk_count(), 1);
+
+    const size_t capacity = arena.capacity();
+    void* const first     = arena.allocate(1);
+    (void)arena.allocate(capacity / 2);
+
+    EXPECT_EQ(arena.chunk_count(), 1);
+
+    arena.reset();
+    EXPECT_EQ(arena.allocate(1), first);
+
+    arena.release();
+    EXPECT_EQ(arena.chunk_count(), 0);
+    EXPECT_EQ(arena.capacity(), 0);
+
+    //Still usable once released
+    EXPECT_NE(arena.allocate(64), nullptr);
+}
+
+TEST(arena_tests, try_expand)
+{
+    expu::arena arena(1024);
+
+    void* const first  = arena.allocate(64);
+    void* const second = arena.allocate(64);
+
+    //Only the most recent allocation may be expanded, whilst within its chunk
+    EXPECT_FALSE(arena.try_expand(first, 64, 128));
+    EXPECT_TRUE(arena.try_expand(second, 64, 128));
+    EXPECT_FALSE(arena.try_expand(second, 128, 4096));
+
+    void* const third = arena.allocate(1);
+    EXPECT_EQ(static_cast<std::byte*>(third), static_cast<std::byte*>(second) + 128);
+}
+
+TEST(arena_allocator_tests, equality_and_rebind)
+{
+    expu::arena first_arena, second_arena;
+
+    const expu::arena_allocator<int> first(first_arena), second(second_arena);
+    const expu::arena_allocator<double> rebound(first);
+
+    EXPECT_TRUE(first == rebound);
+    EXPECT_FALSE(first == second);
+    EXPECT_EQ(&rebound.resource(), &first_arena);
+}
+
+TEST(arena_allocator_tests, darray)
+{
+    expu::arena arena;
+
+    {
+        using array_type = expu::darray<std::string, expu::arena_allocator<std::string>>;
+
+        array_type arr{ expu::arena_allocator<std::string>(arena) };
+        for (int i = 0; i < 1000; ++i)
+            arr.emplace_back(std::to_string(i));
+
+        array_type copy(arr);
+        EXPECT_TRUE(copy.get_allocator() == arr.get_allocator());
+
+        ASSERT_EQ(copy.size(), 1000);
+        for (int i = 0; i < 1000; ++i)
+            ASSERT_EQ(copy.begin()[i], std::to_string(i));
+    }
+
+    arena.reset();
+    EXPECT_EQ(arena.chunk_count(), 1);
+}
+
+TEST(arena_allocator_tests, darray_grows_in_place)
+{
+    expu::arena arena(1 << 16);
+
+    expu::darray<int, expu::arena_allocator<int>> arr{ expu::arena_allocator<int>(arena) };
+    arr.reserve(1);
+
+    const int* const first = std::to_address(arr.begin());
+
+    //As the only allocation, the array expands into the rest of its chunk rather than moving
+    for (int i = 0; i < 1000; ++i)
+        arr.push_back(i);
+
+    EXPECT_EQ(std::to_address(arr.begin()), first);
+    for (int i = 0; i < 1000; ++i)
+        ASSERT_EQ(arr.begin()[i], i);
+}
+
+TEST(arena_allocator_tests, fixed_array)
+{
+    expu::arena arena;
+
+    const expu::arena_allocator<uint64_t> alloc(arena);
+    const expu::fixed_array<uint64_t, expu::arena_allocator<uint64_t>> arr(expu::seq_iter<uint64_t>(0), expu::seq_iter<uint64_t>(100), alloc);
+
+    ASSERT_EQ(arr.size(), 100);
+    for (uint64_t i = 0; i < 100; ++i)
+        ASSERT_EQ(arr[i], i);
+}
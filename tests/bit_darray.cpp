@@ -0,0 +1,178 @@
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "expu/containers/bit_darray.hpp"
+#include "expu/testing/checked_allocator.hpp"
+
+using bit_darray = expu::bit_darray<expu::checked_allocator<std::allocator<uint64_t>, false>>;
+
+//Returns a deterministic pseudo-random sequence of flags.
+static std::vector<bool> _make_flags(const size_t size)
+{
+    std::vector<bool> flags(size);
+
+    uint32_t state = 0x9E3779B9;
+    for (size_t i = 0; i < size; ++i) {
+        state = state * 1664525 + 1013904223;
+        flags[i] = (state >> 29) & 1;
+    }
+
+    return flags;
+}
+
+static void _verify_matches(const bit_darray& arr, const std::vector<bool>& expected)
+{
+    ASSERT_EQ(arr.size(), expected.size());
+    ASSERT_LE(arr.size(), arr.capacity());
+    ASSERT_EQ(std::vector<bool>(arr.begin(), arr.end()), expected);
+
+    //Bits past size() must be zero
+    if (arr.word_count() != 0) {
+        const size_t used_bits = arr.size() & 63;
+        if (used_bits != 0) {
+            ASSERT_EQ(arr.word(arr.word_count() - 1) >> used_bits, 0u);
+        }
+    }
+}
+
+TEST(bit_darray_tests, construction)
+{
+    const bit_darray empty;
+    ASSERT_TRUE(empty.empty());
+    ASSERT_EQ(empty.begin(), empty.end());
+
+    for (const size_t size : { 0, 1, 63, 64, 65, 1000 }) {
+        _verify_matches(bit_darray(size, true),  std::vector<bool>(size, true));
+        _verify_matches(bit_darray(size, false), std::vector<bool>(size, false));
+
+        const std::vector<bool> flags = _make_flags(size);
+        _verify_matches(bit_darray(flags.begin(), flags.end()), flags);
+    }
+}
+
+TEST(bit_darray_tests, copy_and_move)
+{
+    const std::vector<bool> flags = _make_flags(300);
+    bit_darray arr(flags.begin(), flags.end());
+
+    bit_darray copy(arr);
+    _verify_matches(copy, flags);
+    ASSERT_EQ(copy, arr);
+
+    {
+        bit_darray moved(std::move(copy));
+        _verify_matches(moved, flags);
+        ASSERT_TRUE(copy.empty());
+
+        //Note: Moves back, as checked_allocator requires the allocating allocator to outlive its memory.
+        copy = std::move(moved);
+        _verify_matches(copy, flags);
+    }
+
+    //Assigning a shorter array must zero the now unused bits
+    const bit_darray shorter(70, true);
+    arr = shorter;
+    _verify_matches(arr, std::vector<bool>(70, true));
+
+    arr = copy;
+    _verify_matches(arr, flags);
+}
+
+TEST(bit_darray_tests, push_back_and_pop_back)
+{
+    const std::vector<bool> flags = _make_flags(1000);
+
+    bit_darray arr;
+    std::vector<bool> expected;
+    for (const bool flag : flags) {
+        arr.push_back(flag);
+        expected.push_back(flag);
+    }
+    _verify_matches(arr, expected);
+
+    for (size_t i = 0; i < 300; ++i) {
+        arr.pop_back();
+        expected.pop_back();
+    }
+    _verify_matches(arr, expected);
+}
+
+TEST(bit_darray_tests, append_bits)
+{
+    bit_darray arr;
+    std::vector<bool> expected;
+
+    uint64_t word = 0xF0E1D2C3B4A59687;
+    for (const size_t bit_count : { 0, 1, 3, 64, 7, 63, 64, 13, 64, 5 }) {
+        arr.append_bits(word, bit_count);
+
+        for (size_t i = 0; i < bit_count; ++i)
+            expected.push_back((word >> i) & 1);
+
+        word = word * 6364136223846793005 + 1442695040888963407;
+    }
+
+    _verify_matches(arr, expected);
+}
+
+TEST(bit_darray_tests, resize)
+{
+    const std::vector<bool> flags = _make_flags(200);
+
+    bit_darray arr(flags.begin(), flags.end());
+    std::vector<bool> expected(flags);
+
+    for (const size_t size : { 130, 500, 3, 64, 0, 77 })
+        for (const bool value : { true, false }) {
+            arr.resize(size, value);
+            expected.resize(size, value);
+            _verify_matches(arr, expected);
+        }
+}
+
+TEST(bit_darray_tests, reserve_and_shrink_to_fit)
+{
+    bit_darray arr(100, true);
+
+    arr.reserve(1000);
+    ASSERT_GE(arr.capacity(), 1000);
+    _verify_matches(arr, std::vector<bool>(100, true));
+
+    arr.shrink_to_fit();
+    ASSERT_EQ(arr.capacity(), 128);
+    _verify_matches(arr, std::vector<bool>(100, true));
+
+    arr.clear();
+    _verify_matches(arr, {});
+
+    arr.shrink_to_fit();
+    ASSERT_EQ(arr.capacity(), 0);
+}
+
+TEST(bit_darray_tests, element_and_word_access)
+{
+    bit_darray arr(130, false);
+
+    arr[0]   = true;
+    arr[65]  = true;
+    arr.at(129) = true;
+
+    ASSERT_EQ(arr.word_count(), 3);
+    ASSERT_EQ(arr.word(0), 1u);
+    ASSERT_EQ(arr.word(1), 2u);
+    ASSERT_EQ(arr.word(2), 2u);
+
+    ASSERT_THROW((void)arr.at(130), std::out_of_range);
+}
+
+TEST(bit_darray_tests, bit_algorithms)
+{
+    const std::vector<bool> flags = _make_flags(500);
+    bit_darray arr(flags.begin(), flags.end());
+
+    ASSERT_EQ(expu::count(arr.begin(), arr.end(), true), std::count(flags.begin(), flags.end(), true));
+    ASSERT_EQ(expu::find(arr.begin(), arr.end(), true) - arr.begin(), std::find(flags.begin(), flags.end(), true) - flags.begin());
+}
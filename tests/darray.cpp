@@ -2,10 +2,18 @@
 
 #include <memory>
 #include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <ranges>
+#include <span>
 #include <sstream>
+#include <vector>
+
+#include "expu/allocators/mremap_allocator.hpp"
 
 #include "expu/containers/darray.hpp"
 #include "expu/containers/fixed_array.hpp"
+#include "expu/containers/small_darray.hpp"
 
 #include "expu/iterators/concatenated_iterator.hpp"
 #include "expu/iterators/seq_iter.hpp"
@@ -20,15 +28,21 @@
 #include "expu/testing/iterator_downcast.hpp"
 #include "expu/testing/test_type.hpp"
 
+//Note: When EXPU_TEST_SMALL_DARRAY_CAPACITY is defined, the suite is run against expu::small_darray instead.
+#ifdef EXPU_TEST_SMALL_DARRAY_CAPACITY
+template<class Type, template<class ...> class Alloc, class ... ExtraArgs>
+using checked_darray = expu::small_darray<Type, EXPU_TEST_SMALL_DARRAY_CAPACITY, expu::checked_allocator<Alloc<Type, ExtraArgs...>, true>>;
+#else
 template<class Type, template<class ...> class Alloc, class ... ExtraArgs>
 using checked_darray = expu::darray<Type, expu::checked_allocator<Alloc<Type, ExtraArgs...>, true>>;
+#endif // EXPU_TEST_SMALL_DARRAY_CAPACITY
 
 
 //////////////////////////////////////DARRAY CHECKS///////////////////////////////////////////////////////////////////////////////
 
 
-template<class Type, class Alloc, std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
-testing::AssertionResult is_equal(const expu::darray<Type, Alloc>& arr, InputIt first, const Sentinel last)
+template<class Type, class Alloc, class GrowthPolicy, size_t InlineCapacity, std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+testing::AssertionResult is_equal(const expu::_basic_darray<Type, Alloc, GrowthPolicy, InlineCapacity>& arr, InputIt first, const Sentinel last)
 {
     size_t range_size = 0;
 
@@ -46,8 +60,8 @@ testing::AssertionResult is_equal(const expu::darray<Type, Alloc>& arr, InputIt
         return testing::AssertionFailure() << "expu::darray size (" << arr.size() << ") != range size (" << range_size << ")";
 }
 
-template<class Type, class Alloc>
-testing::AssertionResult is_darray_valid(const expu::darray<Type, expu::checked_allocator<Alloc, true>>& darray)
+template<class Type, class Alloc, class GrowthPolicy, size_t InlineCapacity>
+testing::AssertionResult is_darray_valid(const expu::_basic_darray<Type, expu::checked_allocator<Alloc, true>, GrowthPolicy, InlineCapacity>& darray)
 {
     if (darray.capacity() < darray.size())
         return testing::AssertionFailure()
@@ -66,9 +80,9 @@ testing::AssertionResult is_darray_valid(const expu::darray<Type, expu::checked_
 }
 
 //Todo: Make general for container types if needed
-template<class Type, class Alloc, class Callable, class ... Args>
+template<class Type, class Alloc, class GrowthPolicy, size_t InlineCapacity, class Callable, class ... Args>
 testing::AssertionResult provides_weak_guarantee(
-    expu::darray<Type, expu::checked_allocator<Alloc, true>>& darray, Callable&& function, Args&& ... args)
+    expu::_basic_darray<Type, expu::checked_allocator<Alloc, true>, GrowthPolicy, InlineCapacity>& darray, Callable&& function, Args&& ... args)
 {
     try {
         std::invoke(std::forward<Callable>(function), darray, std::forward<Args>(args)...);
@@ -90,7 +104,7 @@ bool is_checked_allocator(const expu::checked_allocator<BaseAllocator, _throw_on
     return true;
 }
 
-template<expu::template_of<expu::darray> ArrayType, std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
+template<class ArrayType, std::input_iterator InputIt, std::sentinel_for<InputIt> Sentinel>
 testing::AssertionResult _verify_unchanged(const ArrayType& arr, const InputIt old_first, const Sentinel old_last, const typename ArrayType::size_type old_capacity)
 {
     //expu::darray must always be in a valid state!
@@ -106,9 +120,9 @@ testing::AssertionResult _verify_unchanged(const ArrayType& arr, const InputIt o
     return is_equal(arr, old_first, old_last);
 }
 
-template<class Type, class Alloc, class Callable, class ... Args>
+template<class Type, class Alloc, class GrowthPolicy, size_t InlineCapacity, class Callable, class ... Args>
 testing::AssertionResult provides_strong_guarantee(
-    expu::darray<Type, expu::checked_allocator<Alloc, true>>& darray, Callable&& function, Args&& ... args)
+    expu::_basic_darray<Type, expu::checked_allocator<Alloc, true>, GrowthPolicy, InlineCapacity>& darray, Callable&& function, Args&& ... args)
 {
     EXPU_NO_THROW_ON(Type, const expu::fixed_array<Type> original_data(darray.begin(), darray.end()));
 
@@ -553,6 +567,56 @@ TYPED_TEST(darray_trivially_destructible_tests, emplace_with_enough_capacity_thr
     }
 }
 
+TYPED_TEST(darray_trivial_tests, unchecked_append)
+{
+    using value_type  = typename TestFixture::value_type;
+    using darray_type = checked_darray<value_type, std::allocator>;
+
+    constexpr int test_size = 1000;
+
+    darray_type arr;
+    arr.reserve(3 * test_size);
+
+    const auto capacity = arr.capacity();
+
+    arr.u_append(expu::seq_iter(0), expu::seq_iter(test_size));
+    arr.u_append_n(test_size, value_type(-1));
+
+    const std::vector<int> source{ expu::seq_iter(test_size), expu::seq_iter(2 * test_size) };
+    arr.u_append(source.begin(), source.end());
+
+    std::vector<int> expected(expu::seq_iter(0), expu::seq_iter(test_size));
+    expected.insert(expected.end(), test_size, -1);
+    expected.insert(expected.end(), source.begin(), source.end());
+
+    EXPECT_EQ(arr.capacity(), capacity);
+    EXPECT_TRUE(is_darray_valid(arr));
+    EXPECT_TRUE(is_equal(arr, expected.begin(), expected.end()));
+}
+
+TEST(darray_emplace_tests, spare_capacity_and_commit)
+{
+    using darray_type = checked_darray<int, std::allocator>;
+
+    darray_type arr(expu::seq_iter(0), expu::seq_iter(10));
+    arr.reserve(100);
+
+    const std::span<int> spare = arr.spare_capacity();
+    ASSERT_EQ(spare.size(), arr.capacity() - arr.size());
+    ASSERT_EQ(spare.data(), std::to_address(arr.end()));
+
+    //Writes as a decoder would, but commits only part of what was written
+    std::iota(spare.begin(), spare.begin() + 50, 10);
+    arr.commit(40);
+
+    EXPECT_EQ(arr.size(), 50);
+    EXPECT_TRUE(is_darray_valid(arr));
+    EXPECT_TRUE(is_equal(arr, expu::seq_iter(0), expu::seq_iter(50)));
+
+    arr.commit(0);
+    EXPECT_EQ(arr.size(), 50);
+}
+
 
 //////////////////////////////////////DARRAY ASSIGN TESTS///////////////////////////////////////////////////////////////////////////////
 
@@ -661,7 +725,7 @@ void _insert_iterator_test_common(int initial_size, int insert_size, size_t capa
         ASSERT_TRUE(pre_check(arr))
             << failure_message.str();
 
-        arr.insert(arr.cbegin() + at, insert_first, insert_last);
+        arr.insert(arr.cbegin() + at, insert_iter_t(insert_first), insert_iter_t(insert_last));
 
         //Expected values of arr post insertion
         auto check_iter = expu::concatenate(init_first, insert_at, insert_first, insert_last, insert_at);
@@ -708,4 +772,891 @@ TYPED_TEST(darray_trivial_iterator_tests, insert_with_enough_capacity)
 
     _insert_iterator_test_common<array_type, typename TestFixture::iterator_category>(
         test_size, insert_size, test_size * 2, 10, _insert_pre_check<array_type, false, insert_size>{});
-}
\ No newline at end of file
+}
+
+//Input only view over [first, last), whose size is known if Sized.
+template<bool Sized>
+auto _input_range(const int first, const int last)
+{
+    using input_iter = expu::iterator_downcast<expu::seq_iter<int>, std::input_iterator_tag>;
+
+    if constexpr (Sized)
+        return std::ranges::subrange<input_iter, input_iter, std::ranges::subrange_kind::sized>(
+            input_iter(expu::seq_iter(first)), input_iter(expu::seq_iter(last)), static_cast<size_t>(last - first));
+    else
+        return std::ranges::subrange(input_iter(expu::seq_iter(first)), input_iter(expu::seq_iter(last)));
+}
+
+template<class ArrayType, class MakeRange>
+testing::AssertionResult _insert_range_test_common(const int initial_size, const int insert_size, const size_t capacity, MakeRange make_range)
+{
+    for (int at = 0; at <= initial_size; at += initial_size / 4) {
+        ArrayType arr(expu::seq_iter(0), expu::seq_iter(initial_size));
+        arr.reserve(capacity);
+
+        const auto result = arr.insert_range(arr.cbegin() + at, make_range(-insert_size, 0));
+
+        std::vector<int> expected(expu::seq_iter(0), expu::seq_iter(initial_size));
+        expected.insert(expected.begin() + at, expu::seq_iter(-insert_size), expu::seq_iter(0));
+
+        if (result != arr.begin() + at)
+            return testing::AssertionFailure() << "Returned iterator does not point to the first inserted element!";
+
+        auto is_valid_result = is_darray_valid(arr);
+        if (!is_valid_result)
+            return is_valid_result << " Inserting at index: " << at;
+
+        auto is_equal_result = is_equal(arr, expected.begin(), expected.end());
+        if (!is_equal_result)
+            return is_equal_result << " Inserting at index: " << at;
+    }
+
+    return testing::AssertionSuccess();
+}
+
+template<class ArrayType>
+testing::AssertionResult _insert_range_test_all(const int initial_size, const int insert_size)
+{
+    const auto forward_range = [](const int first, const int last) { return std::vector<int>(expu::seq_iter(first), expu::seq_iter(last)); };
+
+    for (const size_t capacity : { static_cast<size_t>(initial_size), static_cast<size_t>(initial_size + insert_size) }) {
+        for (auto result : {
+            _insert_range_test_common<ArrayType>(initial_size, insert_size, capacity, _input_range<false>),
+            _insert_range_test_common<ArrayType>(initial_size, insert_size, capacity, _input_range<true>),
+            _insert_range_test_common<ArrayType>(initial_size, insert_size, capacity, forward_range) })
+            if (!result)
+                return result << " With capacity: " << capacity;
+    }
+
+    return testing::AssertionSuccess();
+}
+
+TYPED_TEST(darray_trivial_tests, insert_range)
+{
+    using darray_type = checked_darray<typename TestFixture::value_type, std::allocator>;
+
+    //Inserts less, then more, than is buffered inline
+    EXPECT_TRUE(_insert_range_test_all<darray_type>(1000, 10));
+    EXPECT_TRUE(_insert_range_test_all<darray_type>(1000, 2500));
+}
+
+//Counts calls to allocate
+template<class Type>
+struct counting_allocator : public std::allocator<Type>
+{
+    template<class Other>
+    struct rebind { using other = counting_allocator<Other>; };
+
+    counting_allocator() = default;
+
+    template<class Other>
+    counting_allocator(const counting_allocator<Other>&) noexcept {}
+
+    inline static size_t allocations = 0;
+
+    Type* allocate(const size_t n)
+    {
+        ++allocations;
+        return std::allocator<Type>::allocate(n);
+    }
+};
+
+TEST(darray_insertion_tests, insert_range_allocates_once)
+{
+    expu::darray<int, counting_allocator<int>> arr;
+
+    counting_allocator<int>::allocations = 0;
+    arr.append_range(_input_range<true>(0, 5000));
+    EXPECT_EQ(counting_allocator<int>::allocations, 1);
+
+    //Note: Small enough to be buffered inline
+    arr.shrink_to_fit();
+    counting_allocator<int>::allocations = 0;
+    arr.insert_range(arr.cbegin() + 10, _input_range<false>(0, 100));
+    EXPECT_EQ(counting_allocator<int>::allocations, 1);
+
+    counting_allocator<int>::allocations = 0;
+    arr.insert_range(arr.cbegin() + 10, std::vector<int>(expu::seq_iter(0), expu::seq_iter(5000)));
+    EXPECT_EQ(counting_allocator<int>::allocations, 1);
+    EXPECT_EQ(arr.size(), 10100);
+}
+
+
+//////////////////////////////////////DARRAY RELOCATION TESTS///////////////////////////////////////////////////////////////////////////////
+
+
+//Owns a resource, hence is neither trivially copyable nor trivially destructible, but may safely be relocated via memcpy.
+struct relocatable_handle
+{
+public:
+    relocatable_handle(int value):
+        _value(std::make_unique<int>(value)) {}
+
+    relocatable_handle(const relocatable_handle& other):
+        _value(std::make_unique<int>(*other._value)) {}
+
+    relocatable_handle(relocatable_handle&&) noexcept = default;
+
+    relocatable_handle& operator=(const relocatable_handle& other)
+    {
+        _value = std::make_unique<int>(*other._value);
+        return *this;
+    }
+
+    relocatable_handle& operator=(relocatable_handle&&) noexcept = default;
+
+public:
+    friend bool operator==(const relocatable_handle& lhs, const relocatable_handle& rhs) noexcept { return *lhs._value == *rhs._value; }
+    friend bool operator==(const relocatable_handle& lhs, int rhs) noexcept { return *lhs._value == rhs; }
+
+    friend std::ostream& operator<<(std::ostream& stream, const relocatable_handle& handle)
+    {
+        return stream << *handle._value;
+    }
+
+private:
+    std::unique_ptr<int> _value;
+};
+
+template<>
+struct expu::is_trivially_relocatable<relocatable_handle> : std::true_type {};
+
+template<class Callable>
+struct expu::is_trivially_relocatable<expu::_throw_on<relocatable_handle, Callable>> : std::true_type {};
+
+
+TEST(darray_relocation_tests, traits_test)
+{
+    static_assert(expu::is_trivially_relocatable_v<int>);
+    static_assert(expu::is_trivially_relocatable_v<relocatable_handle>);
+    static_assert(!std::is_trivially_copyable_v<relocatable_handle>);
+    static_assert(!expu::is_trivially_relocatable_v<expu::test_type<int, expu::test_type_props::not_trivially_destructible>>);
+}
+
+TEST(darray_relocation_tests, emplace_back)
+{
+    checked_darray<relocatable_handle, std::allocator> arr;
+
+    constexpr int test_size = 10000;
+    expu::seq_iter first(0), last(test_size);
+
+    for (auto it = first; it != last; ++it)
+        arr.emplace_back(*it);
+
+    EXPECT_TRUE(is_darray_valid(arr));
+    EXPECT_TRUE(is_equal(arr, first, last));
+}
+
+TEST(darray_relocation_tests, emplace)
+{
+    constexpr int test_size = 10000;
+    constexpr int step      = test_size/10;
+
+    using darray_type = checked_darray<relocatable_handle, std::allocator>;
+    EXPECT_TRUE(_emplace_tests_common<darray_type>(test_size, step, test_size * 2, _emplace_pre_check<darray_type, true>{}));
+    EXPECT_TRUE(_emplace_tests_common<darray_type>(test_size, step, test_size, _emplace_pre_check<darray_type, false>{}));
+}
+
+TEST(darray_relocation_tests, insert)
+{
+    using array_type = checked_darray<relocatable_handle, std::allocator>;
+
+    constexpr int test_size   = 10000;
+    constexpr int insert_size = 2500;
+
+    _insert_iterator_test_common<array_type>(
+        test_size, insert_size, test_size, 10, _insert_pre_check<array_type, true, insert_size>{});
+    _insert_iterator_test_common<array_type>(
+        test_size, insert_size, test_size * 2, 10, _insert_pre_check<array_type, false, insert_size>{});
+}
+
+TEST(darray_relocation_tests, insert_range)
+{
+    using array_type = checked_darray<relocatable_handle, std::allocator>;
+
+    EXPECT_TRUE(_insert_range_test_all<array_type>(1000, 10));
+    EXPECT_TRUE(_insert_range_test_all<array_type>(1000, 2500));
+}
+
+TEST(darray_relocation_tests, reserve_then_shrink_to_fit)
+{
+    constexpr int test_size = 10000;
+    const expu::seq_iter first(0), last(test_size);
+
+    checked_darray<relocatable_handle, std::allocator> arr(first, last);
+
+    arr.reserve(test_size * 2);
+    ASSERT_EQ(arr.capacity(), test_size * 2);
+    ASSERT_TRUE(is_darray_valid(arr));
+    ASSERT_TRUE(is_equal(arr, first, last));
+
+    arr.shrink_to_fit();
+    ASSERT_EQ(arr.capacity(), test_size);
+    ASSERT_TRUE(is_darray_valid(arr));
+    ASSERT_TRUE(is_equal(arr, first, last));
+}
+
+TEST(darray_relocation_tests, emplace_with_enough_capacity_strong_guarantee)
+{
+    EXPU_GUARDED_THROW_ON_TYPE(value_type, relocatable_handle, EXPU_MACRO_ARG(expu::throw_on_comp_equal<int, int&&>));
+    using darray_type = checked_darray<value_type, std::allocator>;
+
+    constexpr int test_size     = 10000;
+    constexpr int step          = test_size / 10;
+    constexpr int emplace_value = -10;
+
+    value_type::callable_type::value = emplace_value;
+
+    EXPU_NO_THROW_ON(value_type, darray_type arr(expu::seq_iter(0), expu::seq_iter(test_size)));
+    EXPU_NO_THROW_ON(value_type, arr.reserve(static_cast<size_t>(test_size) << 1));
+
+    for (size_t at = 0; at < test_size; at += step) {
+        ASSERT_TRUE(provides_strong_guarantee(arr, &darray_type::template emplace<int&&>, arr.begin() + at, int{ emplace_value }))
+            << "Failed trying to emplace at index: " << at;
+    }
+}
+
+
+//////////////////////////////////////DARRAY RESIZE TESTS///////////////////////////////////////////////////////////////////////////////
+
+
+TYPED_TEST(darray_trivial_tests, resize)
+{
+    using value_type  = typename TestFixture::value_type;
+    using darray_type = checked_darray<value_type, std::allocator>;
+
+    constexpr int test_size = 10000;
+    const expu::seq_iter first(0), last(test_size);
+
+    darray_type arr(first, last);
+
+    //Requires reallocation
+    arr.resize(test_size * 2, value_type(-1));
+    ASSERT_EQ(arr.size(), test_size * 2);
+    ASSERT_TRUE(is_darray_valid(arr));
+    ASSERT_TRUE(std::ranges::equal(arr.begin(), arr.begin() + test_size, first, last));
+    ASSERT_TRUE(std::ranges::all_of(arr.begin() + test_size, arr.end(), [](const value_type& value) { return value == value_type(-1); }));
+
+    //Shrinks
+    arr.resize(test_size / 2);
+    ASSERT_EQ(arr.size(), test_size / 2);
+    ASSERT_TRUE(is_darray_valid(arr));
+    ASSERT_TRUE(is_equal(arr, first, expu::seq_iter(test_size / 2)));
+
+    //Enough capacity
+    arr.resize(test_size);
+    ASSERT_EQ(arr.size(), test_size);
+    ASSERT_TRUE(is_darray_valid(arr));
+    ASSERT_TRUE(std::ranges::all_of(arr.begin() + test_size / 2, arr.end(), [](const value_type& value) { return value == value_type(); }));
+}
+
+TEST(darray_resize_tests, resize_from_own_element)
+{
+    constexpr int test_size = 1000;
+
+    checked_darray<relocatable_handle, std::allocator> arr(expu::seq_iter(0), expu::seq_iter(test_size));
+
+    arr.resize(test_size * 4, arr[test_size - 1]);
+
+    ASSERT_TRUE(is_darray_valid(arr));
+    ASSERT_TRUE(std::ranges::all_of(arr.begin() + test_size, arr.end(), [](const auto& value) { return value == relocatable_handle(test_size - 1); }));
+}
+
+TEST(darray_resize_tests, resize_for_overwrite)
+{
+    constexpr int test_size = 10000;
+
+    checked_darray<int, std::allocator> arr;
+    arr.resize_for_overwrite(test_size);
+
+    ASSERT_EQ(arr.size(), test_size);
+    ASSERT_TRUE(is_darray_valid(arr));
+
+    std::ranges::copy(expu::seq_iter(0), expu::seq_iter(test_size), arr.begin());
+    ASSERT_TRUE(is_equal(arr, expu::seq_iter(0), expu::seq_iter(test_size)));
+
+    arr.resize_for_overwrite(test_size / 2);
+    ASSERT_TRUE(is_darray_valid(arr));
+    ASSERT_TRUE(is_equal(arr, expu::seq_iter(0), expu::seq_iter(test_size / 2)));
+}
+
+template<class BaseType, size_t throw_after>
+testing::AssertionResult _resize_strong_guarantee_common(const size_t test_size, const size_t new_size, const size_t capacity)
+{
+    EXPU_GUARDED_THROW_ON_TYPE(value_type, BaseType, expu::always_throw_after_x<throw_after>);
+    using darray_type = checked_darray<value_type, std::allocator>;
+
+    EXPU_NO_THROW_ON(value_type, darray_type arr(expu::seq_iter(0), expu::seq_iter(static_cast<int>(test_size))));
+    EXPU_NO_THROW_ON(value_type, arr.reserve(capacity));
+    EXPU_NO_THROW_ON(value_type, const value_type value(-1));
+
+    return provides_strong_guarantee(arr, [](auto& arr, const size_t new_size, const value_type& value) {
+        arr.resize(new_size, value);
+    }, new_size, value);
+}
+
+TYPED_TEST(darray_trivially_destructible_tests, resize_strong_guarantee)
+{
+    using base_type = typename TestFixture::value_type;
+
+    constexpr size_t test_size = 1000;
+
+    //Throws whilst constructing appended elements, with and without enough capacity
+    EXPECT_TRUE((_resize_strong_guarantee_common<base_type, test_size / 2>(test_size, test_size * 2, test_size * 4)));
+    EXPECT_TRUE((_resize_strong_guarantee_common<base_type, test_size / 2>(test_size, test_size * 2, test_size)));
+    //Throws whilst moving elements into reallocated memory
+    EXPECT_TRUE((_resize_strong_guarantee_common<base_type, test_size + test_size / 2>(test_size, test_size * 2, test_size)));
+}
+
+
+//////////////////////////////////////DARRAY ERASE TESTS///////////////////////////////////////////////////////////////////////////////
+
+
+template<class ArrayType>
+testing::AssertionResult _erase_unordered_test_common(const int test_size)
+{
+    ArrayType arr(expu::seq_iter(0), expu::seq_iter(test_size));
+    std::vector<int> expected(expu::seq_iter(0), expu::seq_iter(test_size));
+
+    //Erases from the front, the middle and the back until empty
+    for (int i = 0; !arr.empty(); ++i) {
+        const auto index = static_cast<ptrdiff_t>((i % 3 == 0) ? 0 : (i % 3 == 1) ? arr.size() / 2 : arr.size() - 1);
+
+        const auto next = arr.erase_unordered(arr.cbegin() + index);
+
+        std::swap(expected[index], expected.back());
+        expected.pop_back();
+
+        if (next != arr.begin() + index)
+            return testing::AssertionFailure() << "Returned iterator does not point to the erased position!";
+
+        auto is_valid_result = is_darray_valid(arr);
+        if (!is_valid_result)
+            return is_valid_result;
+
+        auto is_equal_result = is_equal(arr, expected.begin(), expected.end());
+        if (!is_equal_result)
+            return is_equal_result;
+    }
+
+    return testing::AssertionSuccess();
+}
+
+TYPED_TEST(darray_trivial_tests, erase_unordered)
+{
+    using value_type  = typename TestFixture::value_type;
+    using darray_type = checked_darray<value_type, std::allocator>;
+
+    EXPECT_TRUE(_erase_unordered_test_common<darray_type>(300));
+}
+
+TEST(darray_erase_tests, erase_unordered_relocatable)
+{
+    using darray_type = checked_darray<relocatable_handle, std::allocator>;
+
+    EXPECT_TRUE(_erase_unordered_test_common<darray_type>(300));
+}
+
+template<class ArrayType>
+testing::AssertionResult _erase_range_test_common(const int test_size)
+{
+    ArrayType arr(expu::seq_iter(0), expu::seq_iter(test_size));
+    std::vector<int> expected(expu::seq_iter(0), expu::seq_iter(test_size));
+
+    //Erases ranges of growing length from the front, the middle and the back until empty
+    for (int i = 0; !arr.empty(); ++i) {
+        const auto count = std::min(static_cast<ptrdiff_t>(i % 4), static_cast<ptrdiff_t>(arr.size()));
+        const auto index = static_cast<ptrdiff_t>((i % 3 == 0) ? 0 : (i % 3 == 1) ? (arr.size() - count) / 2 : arr.size() - count);
+
+        const auto next = (count == 1) ?
+            arr.erase(arr.cbegin() + index) :
+            arr.erase(arr.cbegin() + index, arr.cbegin() + index + count);
+
+        expected.erase(expected.begin() + index, expected.begin() + index + count);
+
+        if (next != arr.begin() + index)
+            return testing::AssertionFailure() << "Returned iterator does not point to the erased position!";
+
+        auto is_valid_result = is_darray_valid(arr);
+        if (!is_valid_result)
+            return is_valid_result;
+
+        auto is_equal_result = is_equal(arr, expected.begin(), expected.end());
+        if (!is_equal_result)
+            return is_equal_result;
+    }
+
+    return testing::AssertionSuccess();
+}
+
+template<class ArrayType>
+testing::AssertionResult _erase_if_test_common(const int test_size)
+{
+    ArrayType arr(expu::seq_iter(0), expu::seq_iter(test_size));
+    std::vector<int> expected(expu::seq_iter(0), expu::seq_iter(test_size));
+
+    //Erases runs of differing lengths, then nothing, then everything.
+    //Note: Elements are chosen by position, erase_if visiting each element once and in order.
+    for (const int divisor : { 7, 3, 2, test_size + 1, 1 }) {
+        size_t position = 0;
+        const auto erased = arr.erase_if([&position, divisor](const auto&) { return position++ % divisor == 0; });
+
+        position = 0;
+        const auto expected_erased = std::erase_if(expected, [&position, divisor](const int) { return position++ % divisor == 0; });
+
+        if (erased != expected_erased)
+            return testing::AssertionFailure() << "Erased " << erased << " elements, expected " << expected_erased << "!";
+
+        auto is_valid_result = is_darray_valid(arr);
+        if (!is_valid_result)
+            return is_valid_result;
+
+        auto is_equal_result = is_equal(arr, expected.begin(), expected.end());
+        if (!is_equal_result)
+            return is_equal_result;
+    }
+
+    return testing::AssertionSuccess();
+}
+
+TYPED_TEST(darray_trivial_tests, erase_range)
+{
+    using value_type  = typename TestFixture::value_type;
+    using darray_type = checked_darray<value_type, std::allocator>;
+
+    EXPECT_TRUE(_erase_range_test_common<darray_type>(300));
+}
+
+TYPED_TEST(darray_trivial_tests, erase_if)
+{
+    using value_type  = typename TestFixture::value_type;
+    using darray_type = checked_darray<value_type, std::allocator>;
+
+    EXPECT_TRUE(_erase_if_test_common<darray_type>(300));
+}
+
+TEST(darray_erase_tests, erase_if_relocatable)
+{
+    using darray_type = checked_darray<relocatable_handle, std::allocator>;
+
+    EXPECT_TRUE(_erase_if_test_common<darray_type>(300));
+}
+
+TEST(darray_erase_tests, erase_if_throwing_predicate)
+{
+    checked_darray<relocatable_handle, std::allocator> arr(expu::seq_iter(0), expu::seq_iter(100));
+
+    //Throws part way through, after some elements have been erased
+    int visited = 0;
+    EXPECT_THROW(arr.erase_if([&visited](const relocatable_handle& value) {
+        if (++visited == 50)
+            throw std::runtime_error("Predicate failure");
+
+        return value == 10 || value == 20 || value == 30;
+    }), std::runtime_error);
+
+    std::vector<int> expected(expu::seq_iter(0), expu::seq_iter(100));
+    std::erase_if(expected, [](const int value) { return value == 10 || value == 20 || value == 30; });
+
+    EXPECT_TRUE(is_darray_valid(arr));
+    EXPECT_TRUE(is_equal(arr, expected.begin(), expected.end()));
+}
+
+TEST(darray_erase_tests, free_erase_functions)
+{
+    expu::darray<int> arr(expu::seq_iter(0), expu::seq_iter(10));
+
+    EXPECT_EQ(expu::erase(arr, 3), 1);
+    EXPECT_EQ(expu::erase(arr, 3), 0);
+    EXPECT_EQ(expu::erase_if(arr, [](const int value) { return value % 2 == 0; }), 5);
+
+    const std::vector<int> expected = { 1, 5, 7, 9 };
+    EXPECT_TRUE(is_equal(arr, expected.begin(), expected.end()));
+}
+
+TEST(darray_erase_tests, erase_range_relocatable)
+{
+    using darray_type = checked_darray<relocatable_handle, std::allocator>;
+
+    EXPECT_TRUE(_erase_range_test_common<darray_type>(300));
+}
+
+
+//////////////////////////////////////DARRAY ALLOCATOR EXTENSION TESTS///////////////////////////////////////////////////////////////////////////////
+
+
+//Always allocates at least reserved elements, hence any allocation may later be expanded in place up to that size.
+template<class Type>
+struct reserving_allocator : public std::allocator<Type>
+{
+public:
+    static constexpr size_t reserved = 1 << 14;
+
+public:
+    Type* allocate(const size_t n) { return std::allocator<Type>::allocate(std::max(n, reserved)); }
+
+    void deallocate(Type* const ptr, const size_t n) { std::allocator<Type>::deallocate(ptr, std::max(n, reserved)); }
+
+    bool try_expand(Type* const, const size_t old_n, const size_t new_n) noexcept { return std::max(old_n, new_n) <= reserved; }
+};
+
+TEST(darray_allocator_extension_tests, expand_in_place)
+{
+    expu::darray<std::string, reserving_allocator<std::string>> arr;
+    arr.reserve(1);
+
+    const auto first = arr.begin()._unwrapped();
+
+    constexpr int test_size = 10000;
+    for (int i = 0; i < test_size; ++i) {
+        if (i % 2)
+            arr.emplace_back(std::to_string(i));
+        else
+            arr.emplace(arr.cbegin(), std::to_string(i));
+    }
+
+    ASSERT_EQ(first, arr.begin()._unwrapped()) << "Expected buffer to be expanded in place!";
+    ASSERT_EQ(arr.size(), test_size);
+
+    for (int i = 0; i < test_size; ++i) {
+        const int expected = i < test_size / 2 ? test_size - 2 * (i + 1) : 2 * (i - test_size / 2) + 1;
+        ASSERT_EQ(arr[i], std::to_string(expected)) << "At index: " << i;
+    }
+}
+
+//Always moves the allocation when reallocating, as mremap may, hence any reference to an old element dangles.
+template<class Type>
+struct moving_allocator : public std::allocator<Type>
+{
+public:
+    template<class OtherType>
+    struct rebind { using other = moving_allocator<OtherType>; };
+
+public:
+    Type* try_reallocate(Type* const ptr, const size_t old_n, const size_t new_n) noexcept
+    {
+        Type* const result = std::allocator<Type>::allocate(new_n);
+        std::memcpy(result, ptr, std::min(old_n, new_n) * sizeof(Type));
+        std::allocator<Type>::deallocate(ptr, old_n);
+
+        return result;
+    }
+};
+
+TEST(darray_allocator_extension_tests, moving_allocator_self_reference)
+{
+    using array_type = expu::darray<long, moving_allocator<long>, expu::exact_growth>;
+
+    array_type arr(expu::seq_iter(0l), expu::seq_iter(10l));
+
+    //Note: Exact growth means every append below extends the buffer, hence moves it
+    arr.push_back(arr[5]);
+    arr.emplace_back(arr[7]);
+    arr.emplace(arr.cbegin(), arr[9]);
+    arr.insert(arr.cend(), arr.cbegin() + 1, arr.cbegin() + 4);
+
+    const std::vector<long> expected = { 9, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 5, 7, 0, 1, 2 };
+    EXPECT_TRUE(is_equal(arr, expected.begin(), expected.end()));
+
+    //Ranges which are not elements may still extend by moving
+    const std::vector<long> other = { 10, 11 };
+    arr.insert(arr.cend(), other.begin(), other.end());
+    EXPECT_EQ(arr.size(), expected.size() + 2);
+    EXPECT_EQ(arr[arr.size() - 1], 11);
+}
+
+TEST(darray_allocator_extension_tests, mremap_allocator_push_back)
+{
+    expu::darray<int, expu::mremap_allocator<int>> arr;
+
+    constexpr int test_size = 1 << 22;
+    for (int i = 0; i < test_size; ++i)
+        arr.push_back(i);
+
+    ASSERT_TRUE(is_equal(arr, expu::seq_iter(0), expu::seq_iter(test_size)));
+}
+
+TEST(darray_allocator_extension_tests, mremap_allocator_insert_relocatable)
+{
+    using array_type = expu::darray<relocatable_handle, expu::mremap_allocator<relocatable_handle>>;
+
+    constexpr int test_size = 1 << 18;
+    const expu::seq_iter first(0), middle(test_size / 2), last(test_size);
+
+    //Note: Inserting chunks in reverse order, always at the same index, ensures elements must be shifted.
+    array_type arr(first, middle);
+    for (int i = 3; i >= 0; --i)
+        arr.insert(arr.cbegin() + (test_size / 2), middle + (i * test_size / 8), middle + ((i + 1) * test_size / 8));
+
+    ASSERT_TRUE(is_equal(arr, first, last));
+}
+
+
+//////////////////////////////////////DARRAY GROWTH POLICY TESTS///////////////////////////////////////////////////////////////////////////////
+
+
+TEST(darray_growth_policy_tests, next_capacity)
+{
+    constexpr size_t max_size = static_cast<size_t>(-1);
+
+    static_assert(expu::geometric_growth<3, 2>::next_capacity<size_t>(100, 101, max_size, 4) == 150);
+    static_assert(expu::geometric_growth<2, 1>::next_capacity<size_t>(100, 101, max_size, 4) == 200);
+    static_assert(expu::geometric_growth<2, 1>::next_capacity<size_t>(max_size - 1, max_size, max_size, 4) == max_size);
+    static_assert(expu::exact_growth::next_capacity<size_t>(100, 101, max_size, 4) == 101);
+
+    static_assert(expu::page_rounded_growth<>::next_capacity<size_t>(100, 101, max_size, 4) == 1024);
+    static_assert(expu::page_rounded_growth<>::next_capacity<size_t>(1024, 1025, max_size, 4) == 2048);
+
+    static_assert(expu::jemalloc_size_class_growth<>::size_class(1) == 8);
+    static_assert(expu::jemalloc_size_class_growth<>::size_class(17) == 32);
+    static_assert(expu::jemalloc_size_class_growth<>::size_class(129) == 160);
+    static_assert(expu::jemalloc_size_class_growth<>::size_class(257) == 320);
+    static_assert(expu::jemalloc_size_class_growth<>::size_class(4097) == 5120);
+    static_assert(expu::jemalloc_size_class_growth<>::next_capacity<size_t>(100, 101, max_size, 4) == 160);
+}
+
+template<class GrowthPolicy>
+struct darray_growth_policy_tests : public testing::Test {};
+
+using growth_policy_test_types = testing::Types<
+    expu::geometric_growth<3, 2>,
+    expu::geometric_growth<2, 1>,
+    expu::exact_growth,
+    expu::page_rounded_growth<>,
+    expu::jemalloc_size_class_growth<>,
+    expu::parallel_copy_growth<expu::default_growth, 4096>>;
+
+TYPED_TEST_SUITE(darray_growth_policy_tests, growth_policy_test_types);
+
+TYPED_TEST(darray_growth_policy_tests, push_back)
+{
+    using darray_type = expu::darray<int, expu::checked_allocator<std::allocator<int>, true>, TypeParam>;
+
+    constexpr int test_size = 10000;
+
+    darray_type arr;
+    for (int i = 0; i < test_size; ++i) {
+        const auto old_capacity = arr.capacity();
+        arr.push_back(i);
+
+        if (old_capacity != arr.capacity()) {
+            const auto expected = std::clamp(
+                TypeParam::next_capacity(old_capacity, old_capacity + 1, arr.max_size(), sizeof(int)), old_capacity + 1, arr.max_size());
+
+            ASSERT_EQ(arr.capacity(), expected) << "Unexpected growth at size: " << i;
+        }
+    }
+
+    ASSERT_TRUE(is_darray_valid(arr));
+    ASSERT_TRUE(is_equal(arr, expu::seq_iter(0), expu::seq_iter(test_size)));
+}
+
+TEST(darray_parallel_copy_tests, range_functions)
+{
+    //Note: A small threshold, and a size which does not divide in to whole chunks, exercises the parallel paths
+    constexpr expu::parallel_policy policy{ .min_parallel_bytes = 4096, .max_threads = 4 };
+    constexpr size_t test_size = 100003;
+
+    std::vector<uint64_t> source(test_size);
+    std::iota(source.begin(), source.end(), 0);
+
+    std::vector<uint64_t> copied(test_size);
+    EXPECT_EQ(expu::copy(policy, source.begin(), source.end(), copied.begin()), copied.end());
+    EXPECT_EQ(copied, source);
+
+    //Overlapping ranges are still copied correctly
+    expu::copy(policy, copied.begin() + 1, copied.end(), copied.begin());
+    EXPECT_TRUE(std::equal(copied.begin(), copied.end() - 1, source.begin() + 1));
+
+    std::allocator<uint64_t> alloc;
+    uint64_t* const buffer = alloc.allocate(test_size);
+
+    EXPECT_EQ(expu::uninitialised_copy(policy, alloc, source.data(), source.data() + test_size, buffer), buffer + test_size);
+    EXPECT_TRUE(std::equal(buffer, buffer + test_size, source.begin()));
+
+    alloc.deallocate(buffer, test_size);
+}
+
+TEST(darray_parallel_copy_tests, copy_and_reserve)
+{
+    using darray_type = expu::darray<uint64_t, expu::checked_allocator<std::allocator<uint64_t>, true>, expu::parallel_copy_growth<expu::default_growth, 4096>>;
+
+    constexpr uint64_t test_size = 100003;
+
+    darray_type arr{ expu::seq_iter<uint64_t>(0), expu::seq_iter<uint64_t>(test_size) };
+
+    const darray_type copy(arr);
+    ASSERT_TRUE(is_darray_valid(copy));
+    ASSERT_TRUE(is_equal(copy, expu::seq_iter<uint64_t>(0), expu::seq_iter<uint64_t>(test_size)));
+
+    arr.reserve(3 * test_size);
+    ASSERT_TRUE(is_darray_valid(arr));
+    ASSERT_TRUE(is_equal(arr, expu::seq_iter<uint64_t>(0), expu::seq_iter<uint64_t>(test_size)));
+}
+
+
+//////////////////////////////////////STREAM COPY TESTS///////////////////////////////////////////////////////////////////////////////
+
+TEST(darray_stream_copy_tests, unaligned_copies)
+{
+    std::vector<unsigned char> source(1024);
+    std::iota(source.begin(), source.end(), 0);
+
+    //Every alignment of the destination, with sizes either side of the vector widths
+    for (size_t offset = 0; offset < 32; ++offset)
+        for (const size_t size : { size_t(0), size_t(1), size_t(15), size_t(16), size_t(17), size_t(127), size_t(128), size_t(129), 1000 - offset }) {
+            std::vector<unsigned char> dest(1024, 0);
+
+            expu::_stream_memcpy(dest.data() + offset, source.data() + 3, size);
+
+            ASSERT_TRUE(std::equal(dest.begin() + offset, dest.begin() + offset + size, source.begin() + 3));
+            ASSERT_TRUE(std::all_of(dest.begin(), dest.begin() + offset, [](auto c) { return c == 0; }));
+            ASSERT_TRUE(std::all_of(dest.begin() + offset + size, dest.end(), [](auto c) { return c == 0; }));
+        }
+}
+
+TEST(darray_stream_copy_tests, reallocate_above_threshold)
+{
+    //Note: Large enough that reallocation relocates with non-temporal stores
+    constexpr uint64_t test_size = EXPU_STREAM_COPY_THRESHOLD / sizeof(uint64_t) + 3;
+
+    expu::darray<uint64_t, expu::checked_allocator<std::allocator<uint64_t>, true>> arr{
+        expu::seq_iter<uint64_t>(0), expu::seq_iter<uint64_t>(test_size) };
+
+    arr.reserve(test_size + 1);
+    ASSERT_TRUE(is_darray_valid(arr));
+    ASSERT_TRUE(is_equal(arr, expu::seq_iter<uint64_t>(0), expu::seq_iter<uint64_t>(test_size)));
+}
+
+
+//////////////////////////////////////SMALL DARRAY TESTS///////////////////////////////////////////////////////////////////////////////
+
+#ifdef EXPU_TEST_SMALL_DARRAY_CAPACITY
+
+TEST(small_darray_tests, traits_test)
+{
+    using array_type = expu::small_darray<int, 8>;
+
+    static_assert(array_type::inline_capacity == 8);
+    ASSERT_GE(sizeof(array_type), 3 * sizeof(array_type::pointer) + 8 * sizeof(int));
+}
+
+TEST(small_darray_tests, push_back_within_inline_capacity)
+{
+    constexpr int inline_size = EXPU_TEST_SMALL_DARRAY_CAPACITY;
+
+    counting_allocator<int>::allocations = 0;
+    expu::small_darray<int, inline_size, counting_allocator<int>> arr;
+
+    ASSERT_TRUE(arr.is_inline());
+    ASSERT_EQ(arr.capacity(), inline_size);
+
+    for (int i = 0; i < inline_size; ++i)
+        arr.push_back(i);
+
+    EXPECT_TRUE(arr.is_inline());
+    EXPECT_EQ(counting_allocator<int>::allocations, 0);
+    EXPECT_TRUE(is_equal(arr, expu::seq_iter(0), expu::seq_iter(inline_size)));
+
+    arr.push_back(inline_size);
+
+    EXPECT_FALSE(arr.is_inline());
+    EXPECT_EQ(counting_allocator<int>::allocations, 1);
+    EXPECT_TRUE(is_equal(arr, expu::seq_iter(0), expu::seq_iter(inline_size + 1)));
+}
+
+TEST(small_darray_tests, construct_with_iterators_inline)
+{
+    constexpr int test_size = EXPU_TEST_SMALL_DARRAY_CAPACITY / 2;
+
+    const checked_darray<relocatable_handle, std::allocator> arr(expu::seq_iter(0), expu::seq_iter(test_size));
+
+    ASSERT_TRUE(arr.is_inline());
+    ASSERT_TRUE(is_darray_valid(arr));
+    ASSERT_TRUE(is_equal(arr, expu::seq_iter(0), expu::seq_iter(test_size)));
+
+    const auto copied(arr);
+
+    ASSERT_TRUE(copied.is_inline());
+    ASSERT_TRUE(is_darray_valid(copied));
+    ASSERT_TRUE(std::ranges::equal(arr, copied));
+}
+
+TEST(small_darray_tests, move_inline)
+{
+    using darray_type = checked_darray<relocatable_handle, std::allocator>;
+
+    constexpr int test_size = EXPU_TEST_SMALL_DARRAY_CAPACITY;
+
+    darray_type original(expu::seq_iter(0), expu::seq_iter(test_size));
+    darray_type moved(std::move(original));
+
+    ASSERT_TRUE(moved.is_inline());
+    ASSERT_TRUE(original.is_inline());
+    ASSERT_TRUE(original.empty());
+    ASSERT_TRUE(is_darray_valid(original));
+    ASSERT_TRUE(is_darray_valid(moved));
+    ASSERT_TRUE(is_equal(moved, expu::seq_iter(0), expu::seq_iter(test_size)));
+
+    original = std::move(moved);
+
+    ASSERT_TRUE(moved.empty());
+    ASSERT_TRUE(is_darray_valid(original));
+    ASSERT_TRUE(is_darray_valid(moved));
+    ASSERT_TRUE(is_equal(original, expu::seq_iter(0), expu::seq_iter(test_size)));
+}
+
+TEST(small_darray_tests, move_allocated)
+{
+    using darray_type = checked_darray<relocatable_handle, std::allocator>;
+
+    constexpr int test_size = EXPU_TEST_SMALL_DARRAY_CAPACITY * 4;
+
+    darray_type original(expu::seq_iter(0), expu::seq_iter(test_size));
+    const auto* const original_first = &*original.begin();
+
+    darray_type moved(std::move(original));
+
+    ASSERT_EQ(&*moved.begin(), original_first) << "Allocated memory should be stolen, not moved element-wise!";
+    ASSERT_TRUE(original.is_inline());
+    ASSERT_TRUE(is_darray_valid(original));
+    ASSERT_TRUE(is_darray_valid(moved));
+    ASSERT_TRUE(is_equal(moved, expu::seq_iter(0), expu::seq_iter(test_size)));
+}
+
+TEST(small_darray_tests, shrink_to_fit_returns_inline)
+{
+    constexpr int inline_size = EXPU_TEST_SMALL_DARRAY_CAPACITY;
+
+    checked_darray<relocatable_handle, std::allocator> arr(expu::seq_iter(0), expu::seq_iter(inline_size * 4));
+    ASSERT_FALSE(arr.is_inline());
+
+    arr.erase(arr.begin() + inline_size, arr.end());
+    arr.shrink_to_fit();
+
+    ASSERT_TRUE(arr.is_inline());
+    ASSERT_EQ(arr.capacity(), inline_size);
+    ASSERT_TRUE(is_darray_valid(arr));
+    ASSERT_TRUE(is_equal(arr, expu::seq_iter(0), expu::seq_iter(inline_size)));
+}
+
+TEST(small_darray_tests, emplace_inline_strong_guarantee)
+{
+    EXPU_GUARDED_THROW_ON_TYPE(value_type, expu::test_type<int>, EXPU_MACRO_ARG(expu::throw_on_comp_equal<int, int&&>));
+    using darray_type = checked_darray<value_type, std::allocator>;
+
+    constexpr int test_size     = EXPU_TEST_SMALL_DARRAY_CAPACITY / 2;
+    constexpr int emplace_value = -10;
+
+    value_type::callable_type::value = emplace_value;
+
+    for (int at = 0; at <= test_size; ++at) {
+        EXPU_NO_THROW_ON(value_type, darray_type arr(expu::seq_iter(0), expu::seq_iter(test_size)));
+        ASSERT_TRUE(arr.is_inline());
+
+        ASSERT_TRUE(provides_strong_guarantee(arr, &darray_type::template emplace<int&&>, arr.begin() + at, int{ emplace_value }))
+            << "Emplacing at: " << at;
+    }
+}
+
+#endif // EXPU_TEST_SMALL_DARRAY_CAPACITY
@@ -1,10 +1,305 @@
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <functional>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <list>
+
 #include "expu/containers/fixed_array.hpp"
 #include "expu/iterators/seq_iter.hpp"
 
 
+//Returns a deterministic pseudo-random sequence of flags.
+template<class Type>
+static std::vector<Type> _make_flags(const size_t size)
+{
+    std::vector<Type> flags(size);
+
+    uint32_t state = 0x12345678;
+    for (Type& flag : flags) {
+        state = state * 1664525 + 1013904223;
+        flag = static_cast<Type>((state >> 28) & 3 ? 0 : (state >> 24) | 1);
+    }
+
+    return flags;
+}
+
 TEST(fixed_array_bool_tests, construction)
 {
+    //Note: Sizes straddle each vector width to cover the scalar remainder.
+    for (const size_t size : { 0, 1, 8, 15, 16, 17, 31, 32, 33, 100, 1000 }) {
+        const std::vector<uint8_t> flags = _make_flags<uint8_t>(size);
+        const expu::fixed_array<bool> arr(flags.begin(), flags.end());
+
+        ASSERT_EQ(arr.size(), size);
+        for (size_t i = 0; i < size; ++i)
+            ASSERT_EQ(arr[i], flags[i] != 0) << "size: " << size << ", index: " << i;
+    }
+}
+
+TEST(fixed_array_bool_tests, non_contiguous_construction)
+{
+    const std::vector<int> flags = _make_flags<int>(77);
+    const expu::fixed_array<bool> arr(flags.begin(), flags.end());
+
+    ASSERT_EQ(arr.size(), flags.size());
+    for (size_t i = 0; i < flags.size(); ++i)
+        ASSERT_EQ(arr[i], flags[i] != 0);
+}
+
+TEST(fixed_array_bool_tests, fill_construction)
+{
+    for (const bool value : { true, false }) {
+        const expu::fixed_array<bool> arr(21, value);
+
+        ASSERT_EQ(arr.size(), 21);
+        for (size_t i = 0; i < arr.size(); ++i)
+            ASSERT_EQ(arr[i], value);
+    }
+}
+
+
+//////////////////////////////////////FILL CONSTRUCTION///////////////////////////////////////////////////////////////////////////////
+
+
+template<class Type>
+class fixed_array_fill_tests : public testing::Test {};
+
+struct fill_pattern_3 { uint8_t bytes[3]; };
+struct fill_pattern_16 { uint32_t words[4]; };
+
+template<class Type>
+static Type _make_fill_value()
+{
+    Type value;
+    auto bytes = reinterpret_cast<unsigned char*>(&value);
+    for (size_t i = 0; i < sizeof(Type); ++i)
+        bytes[i] = static_cast<unsigned char>(i * 37 + 1);
+
+    return value;
+}
+
+using fill_types = testing::Types<uint8_t, uint16_t, float, double, fill_pattern_3, fill_pattern_16>;
+TYPED_TEST_SUITE(fixed_array_fill_tests, fill_types);
+
+TYPED_TEST(fixed_array_fill_tests, fill_construction)
+{
+    const TypeParam value = _make_fill_value<TypeParam>();
+
+    //Note: Sizes straddle each vector width to cover the scalar remainder.
+    for (const size_t size : { 0, 1, 7, 16, 33, 129, 1000 }) {
+        const expu::fixed_array<TypeParam> arr(size, value);
+
+        ASSERT_EQ(arr.size(), size);
+        for (const TypeParam& elem : arr)
+            ASSERT_EQ(std::memcmp(&elem, &value, sizeof(TypeParam)), 0);
+    }
+}
+
+TYPED_TEST(fixed_array_fill_tests, splat_fill_construction)
+{
+    TypeParam value;
+    std::memset(&value, 0xAB, sizeof(TypeParam));
+
+    const expu::fixed_array<TypeParam> arr(100, value);
+
+    ASSERT_EQ(arr.size(), 100);
+    for (const TypeParam& elem : arr)
+        ASSERT_EQ(std::memcmp(&elem, &value, sizeof(TypeParam)), 0);
+}
+
+
+//////////////////////////////////////BIT PACKING///////////////////////////////////////////////////////////////////////////////
+
+
+TEST(bit_packing_tests, set_bits_matches_scalar)
+{
+    for (const size_t size : { 0, 1, 7, 16, 32, 63, 64, 65, 257 }) {
+        const std::vector<uint8_t> flags = _make_flags<uint8_t>(size);
+
+        std::vector<unsigned char> expected((size + 7) / 8, 0);
+        for (size_t i = 0; i < size; ++i)
+            expected[i >> 3] |= static_cast<unsigned char>((flags[i] != 0) << (i & 7));
+
+        //Note: Packing from a list forces the scalar path.
+        const std::list<uint8_t> flags_list(flags.begin(), flags.end());
+
+        std::vector<unsigned char> vectorised(expected.size() + 1, 0xCD), scalar(expected.size() + 1, 0xCD);
+        void* const vectorised_end = expu::set_bits(vectorised.data(), flags.begin(), flags.end());
+        void* const scalar_end     = expu::set_bits(scalar.data(), flags_list.begin(), flags_list.end());
+
+        ASSERT_EQ(vectorised_end, vectorised.data() + expected.size());
+        ASSERT_EQ(scalar_end, scalar.data() + expected.size());
+        ASSERT_EQ(vectorised.back(), 0xCD);
+
+        vectorised.pop_back();
+        scalar.pop_back();
+        ASSERT_EQ(vectorised, expected);
+        ASSERT_EQ(scalar, expected);
+    }
+}
+
+TEST(bit_packing_tests, unpack_bits_round_trip)
+{
+    for (const size_t size : { 0, 1, 9, 16, 31, 32, 48, 100, 1025 }) {
+        std::vector<bool> expected(size);
+        bool flags[1025];
+        for (size_t i = 0; i < size; ++i)
+            flags[i] = expected[i] = (i * 7 + i / 3) % 5 == 0;
+
+        std::vector<unsigned char> bits((size + 7) / 8);
+        expu::set_bits(bits.data(), flags, flags + size);
+
+        bool unpacked[1026];
+        unpacked[size] = true;
+        ASSERT_EQ(expu::unpack_bits(bits.data(), size, unpacked), unpacked + size);
+        ASSERT_TRUE(unpacked[size]);
+
+        std::vector<bool> unpacked_scalar;
+        expu::unpack_bits(bits.data(), size, std::back_inserter(unpacked_scalar));
+
+        ASSERT_EQ(std::vector<bool>(unpacked, unpacked + size), expected);
+        ASSERT_EQ(unpacked_scalar, expected);
+    }
+}
+
+
+//////////////////////////////////////BIT ALGORITHMS///////////////////////////////////////////////////////////////////////////////
+
+
+//Returns a fixed_array<bool> along with its flags as a reference.
+static std::pair<expu::fixed_array<bool>, std::vector<bool>> _make_bool_array(const size_t size, const uint32_t seed = 0)
+{
+    std::vector<uint8_t> flags = _make_flags<uint8_t>(size + seed);
+    flags.erase(flags.begin(), flags.begin() + seed);
+
+    return { expu::fixed_array<bool>(flags.begin(), flags.end()), std::vector<bool>(flags.begin(), flags.end()) };
+}
+
+//Note: Offsets and sizes cover unaligned first bits, whole words and partial trailing words.
+static constexpr size_t _bit_offsets[] = { 0, 1, 7, 8, 13, 64, 65 };
+static constexpr size_t _bit_sizes[]   = { 0, 1, 8, 63, 64, 65, 200, 1000 };
+
+TEST(bit_algorithms_tests, iterator_arithmetic)
+{
+    auto [arr, expected] = _make_bool_array(100);
+
+    for (const ptrdiff_t from : { 0, 1, 7, 8, 9, 50, 99 })
+        for (const ptrdiff_t by : { -9, -8, -7, -1, 0, 1, 7, 8, 9 }) {
+            if (from + by < 0 || from + by > 99)
+                continue;
+
+            const auto moved = arr.cbegin() + from + by;
+            ASSERT_EQ(moved - arr.cbegin(), from + by);
+            ASSERT_EQ(static_cast<bool>(*moved), expected[from + by]);
+        }
+}
+
+TEST(bit_algorithms_tests, count_and_find)
+{
+    const auto [arr, expected] = _make_bool_array(1100);
+
+    for (const size_t offset : _bit_offsets)
+        for (const size_t size : _bit_sizes) {
+            const auto first = arr.begin() + offset, last = first + size;
+            const auto expected_first = expected.begin() + offset, expected_last = expected_first + size;
+
+            for (const bool value : { true, false }) {
+                ASSERT_EQ(expu::count(first, last, value), std::count(expected_first, expected_last, value));
+                ASSERT_EQ(expu::find(first, last, value) - first, std::find(expected_first, expected_last, value) - expected_first);
+            }
+
+            ASSERT_EQ(expu::all_of(first, last),  std::all_of(expected_first, expected_last, std::identity{}));
+            ASSERT_EQ(expu::any_of(first, last),  std::any_of(expected_first, expected_last, std::identity{}));
+            ASSERT_EQ(expu::none_of(first, last), std::none_of(expected_first, expected_last, std::identity{}));
+        }
+}
+
+TEST(bit_algorithms_tests, find_at_end)
+{
+    expu::fixed_array<bool> arr(300, false);
+    arr[299] = true;
+
+    ASSERT_EQ(expu::find(arr.begin(), arr.end(), true) - arr.begin(), 299);
+    ASSERT_EQ(expu::find(arr.begin(), arr.end() - 1, true), arr.end() - 1);
+    ASSERT_TRUE(expu::none_of(arr.begin(), arr.end() - 1));
+}
+
+TEST(bit_algorithms_tests, fill)
+{
+    for (const size_t offset : _bit_offsets)
+        for (const size_t size : _bit_sizes)
+            for (const bool value : { true, false }) {
+                auto [arr, expected] = _make_bool_array(1100);
+
+                expu::fill(arr.begin() + offset, arr.begin() + offset + size, value);
+                std::fill(expected.begin() + offset, expected.begin() + offset + size, value);
+
+                ASSERT_EQ(std::vector<bool>(arr.begin(), arr.end()), expected) << "offset: " << offset << ", size: " << size;
+            }
+}
+
+TEST(bit_algorithms_tests, copy)
+{
+    const auto [source, expected_source] = _make_bool_array(1100, 5);
+
+    for (const size_t in_offset : _bit_offsets)
+        for (const size_t out_offset : _bit_offsets)
+            for (const size_t size : _bit_sizes) {
+                auto [arr, expected] = _make_bool_array(1100);
+
+                const auto result = expu::copy(source.begin() + in_offset, source.begin() + in_offset + size, arr.begin() + out_offset);
+                std::copy(expected_source.begin() + in_offset, expected_source.begin() + in_offset + size, expected.begin() + out_offset);
+
+                ASSERT_EQ(result - arr.begin(), static_cast<ptrdiff_t>(out_offset + size));
+                ASSERT_EQ(std::vector<bool>(arr.begin(), arr.end()), expected);
+            }
+}
+
+TEST(bit_algorithms_tests, bitwise_operations)
+{
+    const auto [lhs, expected_lhs] = _make_bool_array(1100, 3);
+    const auto [rhs, expected_rhs] = _make_bool_array(1100, 11);
+
+    for (const size_t offset : _bit_offsets)
+        for (const size_t size : _bit_sizes) {
+            auto [and_arr, expected_and] = _make_bool_array(1100);
+            auto [or_arr,  expected_or]  = _make_bool_array(1100);
+            auto [xor_arr, expected_xor] = _make_bool_array(1100);
+            auto [not_arr, expected_not] = _make_bool_array(1100);
+
+            const auto lhs_first = lhs.begin() + offset, rhs_first = rhs.begin() + 1;
+            expu::bitwise_and(lhs_first, lhs_first + size, rhs_first, and_arr.begin() + 2);
+            expu::bitwise_or (lhs_first, lhs_first + size, rhs_first, or_arr.begin() + 2);
+            expu::bitwise_xor(lhs_first, lhs_first + size, rhs_first, xor_arr.begin() + 2);
+            expu::bitwise_not(lhs_first, lhs_first + size, not_arr.begin() + 2);
+
+            for (size_t i = 0; i < size; ++i) {
+                expected_and[i + 2] = expected_lhs[offset + i] && expected_rhs[i + 1];
+                expected_or[i + 2]  = expected_lhs[offset + i] || expected_rhs[i + 1];
+                expected_xor[i + 2] = expected_lhs[offset + i] != expected_rhs[i + 1];
+                expected_not[i + 2] = !expected_lhs[offset + i];
+            }
+
+            ASSERT_EQ(std::vector<bool>(and_arr.begin(), and_arr.end()), expected_and);
+            ASSERT_EQ(std::vector<bool>(or_arr.begin(),  or_arr.end()),  expected_or);
+            ASSERT_EQ(std::vector<bool>(xor_arr.begin(), xor_arr.end()), expected_xor);
+            ASSERT_EQ(std::vector<bool>(not_arr.begin(), not_arr.end()), expected_not);
+        }
+}
+
+TEST(bit_algorithms_tests, in_place_bitwise_operations)
+{
+    auto [arr, expected] = _make_bool_array(500);
+    const auto [mask, expected_mask] = _make_bool_array(500, 7);
+
+    expu::bitwise_and(arr.cbegin() + 3, arr.cend(), mask.begin(), arr.begin() + 3);
+    expu::bitwise_not(arr.cbegin(), arr.cend(), arr.begin());
+
+    for (size_t i = 0; i < expected.size(); ++i)
+        expected[i] = !(i < 3 ? expected[i] : expected[i] && expected_mask[i - 3]);
 
-}
\ No newline at end of file
+    ASSERT_EQ(std::vector<bool>(arr.begin(), arr.end()), expected);
+}
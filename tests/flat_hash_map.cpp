@@ -0,0 +1,216 @@
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "expu/containers/flat_hash_map.hpp"
+
+template<class Map, class Reference>
+static testing::AssertionResult is_equal(const Map& map, const Reference& reference)
+{
+    if (map.size() != reference.size())
+        return testing::AssertionFailure() << "size: " << map.size() << ", expected: " << reference.size();
+
+    size_t iterated = 0;
+    for (const auto& [key, value] : map) {
+        const auto loc = reference.find(key);
+
+        if (loc == reference.end() || !(loc->second == value))
+            return testing::AssertionFailure() << "unexpected element";
+
+        ++iterated;
+    }
+
+    if (iterated != reference.size())
+        return testing::AssertionFailure() << "iterated: " << iterated << ", expected: " << reference.size();
+
+    for (const auto& [key, value] : reference)
+        if (!map.contains(key) || !(map.at(key) == value))
+            return testing::AssertionFailure() << "missing element";
+
+    return testing::AssertionSuccess();
+}
+
+TEST(flat_hash_map_tests, empty)
+{
+    const expu::flat_hash_map<int, int> map;
+
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.begin(), map.end());
+    ASSERT_EQ(map.find(5), map.end());
+    ASSERT_FALSE(map.contains(5));
+    ASSERT_THROW((void)map.at(5), std::out_of_range);
+}
+
+TEST(flat_hash_map_tests, insert_and_find)
+{
+    expu::flat_hash_map<int, int> map;
+    std::unordered_map<int, int> reference;
+
+    for (int i = 0; i < 1000; ++i) {
+        map[i * 7] = i;
+        reference[i * 7] = i;
+    }
+
+    ASSERT_TRUE(is_equal(map, reference));
+    ASSERT_LE(map.load_factor(), 7.0f / 8.0f);
+
+    const auto [loc, inserted] = map.try_emplace(7, -1);
+    ASSERT_FALSE(inserted);
+    ASSERT_EQ(loc->second, 1);
+
+    ASSERT_TRUE(map.insert({ 1, 2 }).second);
+    ASSERT_FALSE(map.emplace(1, 3).second);
+    ASSERT_EQ(map.at(1), 2);
+}
+
+TEST(flat_hash_map_tests, random_operations)
+{
+    expu::flat_hash_map<uint64_t, uint64_t> map;
+    std::unordered_map<uint64_t, uint64_t> reference;
+
+    //Note: A small key space ensures erasures hit, leaving deleted slots to be reused.
+    uint64_t state = 42;
+    for (int i = 0; i < 100000; ++i) {
+        state = state * 6364136223846793005 + 1442695040888963407;
+        const uint64_t key = (state >> 33) % 2000;
+
+        if ((state >> 20) & 1) {
+            map[key] = state;
+            reference[key] = state;
+        }
+        else
+            ASSERT_EQ(map.erase(key), reference.erase(key));
+    }
+
+    ASSERT_TRUE(is_equal(map, reference));
+}
+
+TEST(flat_hash_map_tests, non_trivial_elements)
+{
+    expu::flat_hash_map<std::string, std::unique_ptr<int>> map;
+
+    for (int i = 0; i < 200; ++i)
+        map.try_emplace(std::to_string(i), std::make_unique<int>(i));
+
+    for (int i = 0; i < 200; i += 2)
+        ASSERT_EQ(map.erase(std::to_string(i)), 1);
+
+    ASSERT_EQ(map.size(), 100);
+    for (int i = 1; i < 200; i += 2)
+        ASSERT_EQ(*map.at(std::to_string(i)), i);
+}
+
+TEST(flat_hash_map_tests, erase_iterator)
+{
+    expu::flat_hash_map<int, int> map;
+    for (int i = 0; i < 100; ++i)
+        map[i] = i;
+
+    //Erases every odd value whilst iterating
+    for (auto it = map.begin(); it != map.end();) {
+        if (it->second & 1)
+            it = map.erase(it);
+        else
+            ++it;
+    }
+
+    ASSERT_EQ(map.size(), 50);
+    for (const auto& [key, value] : map)
+        ASSERT_EQ(value % 2, 0);
+}
+
+TEST(flat_hash_map_tests, copy_and_move)
+{
+    expu::flat_hash_map<std::string, int> map;
+    for (int i = 0; i < 100; ++i)
+        map[std::to_string(i)] = i;
+
+    expu::flat_hash_map<std::string, int> copy(map);
+    ASSERT_EQ(copy, map);
+
+    expu::flat_hash_map<std::string, int> moved(std::move(copy));
+    ASSERT_EQ(moved, map);
+    ASSERT_TRUE(copy.empty());
+
+    copy = moved;
+    ASSERT_EQ(copy, map);
+
+    moved["extra"] = 1;
+    ASSERT_FALSE(moved == map);
+
+    map = std::move(moved);
+    ASSERT_EQ(map.size(), 101);
+}
+
+TEST(flat_hash_map_tests, clear_and_reserve)
+{
+    expu::flat_hash_map<int, int> map;
+
+    map.reserve(1000);
+    const size_t capacity = map.capacity();
+    ASSERT_GE(capacity, 1000);
+
+    for (int i = 0; i < 1000; ++i)
+        map[i] = i;
+    ASSERT_EQ(map.capacity(), capacity);
+
+    map.clear();
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.begin(), map.end());
+    ASSERT_EQ(map.capacity(), capacity);
+
+    map[3] = 4;
+    ASSERT_EQ(map.at(3), 4);
+}
+
+TEST(flat_hash_map_tests, colliding_hashes)
+{
+    //Note: Every key shares a hash, hence lookups must rely on key comparison.
+    struct constant_hash { size_t operator()(int) const noexcept { return 0; } };
+
+    expu::flat_hash_map<int, int, constant_hash> map;
+    for (int i = 0; i < 100; ++i)
+        map[i] = -i;
+
+    for (int i = 0; i < 100; i += 3)
+        map.erase(i);
+
+    for (int i = 0; i < 100; ++i) {
+        if (i % 3 == 0)
+            ASSERT_FALSE(map.contains(i));
+        else
+            ASSERT_EQ(map.at(i), -i);
+    }
+}
+
+//Backs flat_hash_map with std::vector, which lacks resize_for_overwrite
+struct vector_storage
+{
+    template<class Type, class Alloc>
+    using container = std::vector<Type, Alloc>;
+};
+
+TEST(flat_hash_map_tests, custom_storage)
+{
+    using map_type = expu::flat_hash_map<std::string, int, std::hash<std::string>, std::equal_to<std::string>, std::allocator<std::pair<const std::string, int>>, vector_storage>;
+
+    map_type map;
+    std::unordered_map<std::string, int> reference;
+
+    for (int i = 0; i < 1000; ++i) {
+        map[std::to_string(i)]       = i;
+        reference[std::to_string(i)] = i;
+    }
+
+    for (int i = 0; i < 1000; i += 7) {
+        map.erase(std::to_string(i));
+        reference.erase(std::to_string(i));
+    }
+
+    const map_type copy(map);
+    ASSERT_TRUE(is_equal(copy, reference));
+}
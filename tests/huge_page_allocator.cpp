@@ -0,0 +1,50 @@
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <cstring>
+
+#include "expu/allocators/huge_page_allocator.hpp"
+#include "expu/containers/darray.hpp"
+#include "expu/containers/fixed_array.hpp"
+#include "expu/iterators/seq_iter.hpp"
+
+
+TEST(huge_page_allocator_tests, large_allocations_are_huge_page_aligned)
+{
+    expu::huge_page_allocator<char> alloc;
+
+    //Note: Sizes just either side of a huge page, such that the mapping is rounded up
+    for (const size_t size : { expu::_huge_page_size, expu::_huge_page_size + 1, 3 * expu::_huge_page_size - 1 }) {
+        char* const ptr = alloc.allocate(size);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % expu::_huge_page_size, 0) << "Size: " << size;
+
+        std::memset(ptr, 1, size);
+        alloc.deallocate(ptr, size);
+    }
+
+    //Small allocations are forwarded to std::allocator
+    char* const small = alloc.allocate(64);
+    std::memset(small, 1, 64);
+    alloc.deallocate(small, 64);
+}
+
+TEST(huge_page_allocator_tests, darray_push_back)
+{
+    expu::darray<uint64_t, expu::huge_page_allocator<uint64_t>> arr;
+
+    constexpr uint64_t test_size = uint64_t(1) << 20;
+    for (uint64_t i = 0; i < test_size; ++i)
+        arr.push_back(i);
+
+    ASSERT_TRUE(std::equal(arr.begin(), arr.end(), expu::seq_iter<uint64_t>(0)));
+}
+
+TEST(huge_page_allocator_tests, fixed_array_construct)
+{
+    constexpr size_t test_size = size_t(1) << 20;
+
+    const expu::fixed_array<uint32_t, expu::huge_page_allocator<uint32_t>> arr(test_size, 7);
+
+    ASSERT_EQ(arr.size(), test_size);
+    EXPECT_TRUE(std::all_of(arr.begin(), arr.end(), [](uint32_t value) { return value == 7; }));
+}
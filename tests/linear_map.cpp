@@ -0,0 +1,241 @@
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "expu/containers/linear_map.hpp"
+#include "expu/containers/split_darray.hpp"
+
+template<class KeyType>
+using split_linear_map = expu::linear_map<KeyType, int, expu::split_darray<KeyType, int>>;
+
+template<class KeyType>
+static KeyType _make_key(const size_t index)
+{
+    if constexpr (std::is_pointer_v<KeyType>) {
+        static char buffer[1024];
+        return buffer + index;
+    }
+    else if constexpr (std::is_enum_v<KeyType>)
+        return static_cast<KeyType>(_make_key<std::underlying_type_t<KeyType>>(index));
+    else
+        //Note: Distinct keys sharing most of their bytes ensure each byte of a key is compared
+        return static_cast<KeyType>(index * 0x0101 + 3);
+}
+
+enum class small_enum : uint16_t {};
+
+template<class KeyType>
+class linear_map_scan_tests : public testing::Test {};
+
+using scan_key_types = testing::Types<int8_t, uint16_t, int32_t, uint64_t, const char*, small_enum>;
+TYPED_TEST_SUITE(linear_map_scan_tests, scan_key_types);
+
+TYPED_TEST(linear_map_scan_tests, find)
+{
+    using key_type = TypeParam;
+
+    //Note: Sizes cover maps shorter than, equal to and spanning several vectors, with scalar tails
+    for (size_t size : { 0, 1, 3, 4, 7, 8, 15, 16, 17, 31, 32, 33, 100 }) {
+        split_linear_map<key_type> map;
+
+        for (size_t i = 0; i < size; ++i)
+            map[_make_key<key_type>(i)] = static_cast<int>(i);
+
+        ASSERT_EQ(map.size(), size);
+
+        for (size_t i = 0; i < size; ++i) {
+            const auto loc = map.find(_make_key<key_type>(i));
+
+            ASSERT_NE(loc, map.end());
+            ASSERT_EQ(loc->first, _make_key<key_type>(i));
+            ASSERT_EQ(loc->second, static_cast<int>(i));
+        }
+
+        ASSERT_EQ(map.find(_make_key<key_type>(size)), map.end());
+    }
+}
+
+TYPED_TEST(linear_map_scan_tests, erase)
+{
+    using key_type = TypeParam;
+
+    split_linear_map<key_type> map;
+    for (size_t i = 0; i < 40; ++i)
+        map[_make_key<key_type>(i)] = static_cast<int>(i);
+
+    for (size_t i = 0; i < 40; i += 3)
+        map.erase(_make_key<key_type>(i));
+
+    for (size_t i = 0; i < 40; ++i) {
+        if (i % 3 == 0)
+            ASSERT_EQ(map.find(_make_key<key_type>(i)), map.end());
+        else
+            ASSERT_EQ(map.at(_make_key<key_type>(i)), static_cast<int>(i));
+    }
+}
+
+TEST(linear_map_tests, matches_array_of_structs)
+{
+    expu::linear_map<std::string, int>                                          aos_map;
+    expu::linear_map<std::string, int, expu::split_darray<std::string, int>>    soa_map;
+
+    for (int i = 0; i < 50; ++i) {
+        aos_map[std::to_string(i * 7 % 13)] += i;
+        soa_map[std::to_string(i * 7 % 13)] += i;
+    }
+
+    aos_map.erase("5");
+    soa_map.erase("5");
+
+    ASSERT_EQ(aos_map.size(), soa_map.size());
+
+    auto soa_it = soa_map.begin();
+    for (const auto& [key, value] : aos_map) {
+        ASSERT_EQ((*soa_it).first, key);
+        ASSERT_EQ((*soa_it).second, value);
+        ++soa_it;
+    }
+
+    ASSERT_EQ(soa_it, soa_map.end());
+    ASSERT_THROW((void)soa_map.at("5"), std::out_of_range);
+}
+
+TEST(linear_map_tests, copy_and_compare)
+{
+    split_linear_map<int> map;
+    for (int i = 0; i < 20; ++i)
+        map[i] = -i;
+
+    split_linear_map<int> copy(map);
+    ASSERT_EQ(copy, map);
+
+    copy[3] = 3;
+    ASSERT_NE(copy, map);
+
+    swap(copy, map);
+    ASSERT_EQ(map.at(3), 3);
+    ASSERT_EQ(copy.at(3), -3);
+}
+
+TEST(linear_map_tests, unordered_erase)
+{
+    expu::linear_map<int, int, std::vector<std::pair<int, int>>, std::equal_to<int>, expu::unordered_erase> vector_map;
+    expu::linear_map<int, int, expu::split_darray<int, int>, std::equal_to<int>, expu::unordered_erase>     split_map;
+
+    for (int i = 0; i < 100; ++i) {
+        vector_map[i] = -i;
+        split_map[i]  = -i;
+    }
+
+    //The last element takes the place of the erased element
+    vector_map.erase(0);
+    split_map.erase(0);
+
+    ASSERT_EQ(vector_map.begin()->first, 99);
+    ASSERT_EQ((*split_map.begin()).first, 99);
+
+    for (int i = 3; i < 100; i += 3) {
+        vector_map.erase(i);
+        split_map.erase(i);
+    }
+
+    for (int i = 0; i < 100; ++i) {
+        if (i % 3 == 0) {
+            ASSERT_EQ(vector_map.find(i), vector_map.end());
+            ASSERT_EQ(split_map.find(i), split_map.end());
+        }
+        else {
+            ASSERT_EQ(vector_map.at(i), -i);
+            ASSERT_EQ(split_map.at(i), -i);
+        }
+    }
+}
+
+//Key counting its constructions, comparable with std::string_view without conversion
+struct counted_key
+{
+    explicit counted_key(std::string_view new_value) :
+        value(new_value) { ++constructions; }
+
+    counted_key(const counted_key& other) :
+        value(other.value) { ++constructions; }
+
+    counted_key& operator=(const counted_key&) = default;
+
+    friend bool operator==(const counted_key& lhs, const counted_key& rhs)      { return lhs.value == rhs.value; }
+    friend bool operator==(const counted_key& lhs, const std::string_view& rhs) { return lhs.value == rhs; }
+
+    std::string value;
+
+    static inline size_t constructions = 0;
+};
+
+template<class Map>
+class linear_map_transparent_tests : public testing::Test {};
+
+using transparent_map_types = testing::Types<
+    expu::linear_map<counted_key, int, std::vector<std::pair<counted_key, int>>, std::equal_to<>>,
+    expu::linear_map<counted_key, int, expu::split_darray<counted_key, int>, std::equal_to<>>>;
+TYPED_TEST_SUITE(linear_map_transparent_tests, transparent_map_types);
+
+TYPED_TEST(linear_map_transparent_tests, lookup)
+{
+    using namespace std::string_view_literals;
+
+    TypeParam map;
+    map["one"sv]   = 1;
+    map["two"sv]   = 2;
+    map["three"sv] = 3;
+
+    const TypeParam& const_map = map;
+
+    counted_key::constructions = 0;
+
+    ASSERT_EQ(map.find("two"sv)->second, 2);
+    ASSERT_EQ(const_map.find("three"sv)->second, 3);
+    ASSERT_EQ(map.find("four"sv), map.end());
+
+    ASSERT_EQ(map.at("one"sv), 1);
+    ASSERT_EQ(const_map.at("two"sv), 2);
+    ASSERT_THROW((void)map.at("four"sv), std::out_of_range);
+
+    ASSERT_EQ(map["three"sv], 3);
+    ASSERT_EQ(const_map["one"sv], 1);
+
+    map.erase("two"sv);
+    ASSERT_EQ(map.find("two"sv), map.end());
+
+    //None of the lookups above may construct a key
+    ASSERT_EQ(counted_key::constructions, 0);
+
+    map["four"sv] = 4;
+    ASSERT_EQ(map.at(counted_key("four")), 4);
+    ASSERT_EQ(map.size(), 3);
+}
+
+TEST(split_darray_tests, emplace_and_erase)
+{
+    expu::split_darray<int, std::string> arr;
+
+    arr.emplace_back(1, "one");
+    arr.emplace_back(3, "three");
+    arr.emplace(arr.cbegin() + 1, 2, "two");
+    arr.emplace(arr.cbegin(), 0, "zero");
+
+    ASSERT_EQ(arr.size(), 4);
+    for (int i = 0; i < 4; ++i)
+        ASSERT_EQ(arr.keys()[i], i);
+
+    ASSERT_EQ(arr.mapped()[2], "two");
+
+    const auto next = arr.erase(arr.cbegin() + 1);
+    ASSERT_EQ(next->first, 2);
+    ASSERT_EQ(next->second, "two");
+    ASSERT_EQ(arr.size(), 3);
+
+    arr.clear();
+    ASSERT_TRUE(arr.empty());
+    ASSERT_EQ(arr.begin(), arr.end());
+}
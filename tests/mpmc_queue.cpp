@@ -0,0 +1,160 @@
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "expu/allocators/pool_allocator.hpp"
+#include "expu/containers/darray.hpp"
+#include "expu/containers/mpmc_queue.hpp"
+#include "expu/iterators/seq_iter.hpp"
+
+
+TEST(mpmc_queue_tests, capacity_is_rounded_up)
+{
+    EXPECT_EQ(expu::mpmc_queue<int>(0).capacity(),    2);
+    EXPECT_EQ(expu::mpmc_queue<int>(1).capacity(),    2);
+    EXPECT_EQ(expu::mpmc_queue<int>(5).capacity(),    8);
+    EXPECT_EQ(expu::mpmc_queue<int>(1024).capacity(), 1024);
+
+    //Head and tail must not share a cache line
+    EXPECT_GE(sizeof(expu::mpmc_queue<int>), 3 * expu::_cache_line_size);
+}
+
+TEST(mpmc_queue_tests, fifo_full_and_empty)
+{
+    expu::mpmc_queue<int> queue(4);
+
+    int value = -1;
+    EXPECT_FALSE(queue.try_pop(value));
+    EXPECT_EQ(value, -1);
+
+    //Wrap around the ring several times
+    for (int lap = 0; lap < 3; ++lap) {
+        for (int i = 0; i < 4; ++i)
+            ASSERT_TRUE(queue.try_push(lap * 4 + i));
+
+        EXPECT_FALSE(queue.try_push(-1));
+        EXPECT_EQ(queue.size_approx(), 4);
+
+        for (int i = 0; i < 4; ++i) {
+            ASSERT_TRUE(queue.try_pop(value));
+            ASSERT_EQ(value, lap * 4 + i);
+        }
+
+        EXPECT_FALSE(queue.try_pop(value));
+        EXPECT_EQ(queue.size_approx(), 0);
+    }
+}
+
+TEST(mpmc_queue_tests, batched_push_and_pop)
+{
+    expu::mpmc_queue<uint64_t> queue(16);
+
+    //Only as many elements as there is room for are pushed
+    EXPECT_EQ(queue.try_push_n(expu::seq_iter<uint64_t>(0), 10), 10);
+    EXPECT_EQ(queue.try_push_n(expu::seq_iter<uint64_t>(10), 10), 6);
+    EXPECT_EQ(queue.try_push_n(expu::seq_iter<uint64_t>(16), 10), 0);
+
+    std::vector<uint64_t> popped;
+    EXPECT_EQ(queue.try_pop_n(std::back_inserter(popped), 4), 4);
+
+    //Pushes may wrap around the end of the ring
+    EXPECT_EQ(queue.try_push_n(expu::seq_iter<uint64_t>(16), 10), 4);
+
+    EXPECT_EQ(queue.try_pop_n(std::back_inserter(popped), 100), 16);
+    EXPECT_EQ(queue.try_pop_n(std::back_inserter(popped), 100), 0);
+
+    ASSERT_EQ(popped.size(), 20);
+    for (uint64_t i = 0; i < 20; ++i)
+        ASSERT_EQ(popped[i], i);
+}
+
+TEST(mpmc_queue_tests, non_trivial_type)
+{
+    expu::pool pool;
+
+    {
+        using string_alloc = expu::pool_allocator<std::string>;
+
+        expu::mpmc_queue<std::string, string_alloc> queue(8, string_alloc(pool));
+        EXPECT_EQ(&queue.get_allocator().resource(), &pool);
+
+        std::vector<std::string> source;
+        for (int i = 0; i < 6; ++i)
+            source.push_back(std::string(100, static_cast<char>('a' + i)));
+
+        EXPECT_EQ(queue.try_push_n(std::make_move_iterator(source.begin()), source.size()), 6);
+        EXPECT_TRUE(queue.try_emplace(3, 'z'));
+
+        std::string value;
+        ASSERT_TRUE(queue.try_pop(value));
+        EXPECT_EQ(value, std::string(100, 'a'));
+
+        //Remaining elements are destroyed along with the queue, caught by the sanitizers if leaked
+    }
+}
+
+TEST(mpmc_queue_tests, passes_darrays_between_threads)
+{
+    using buffer_type = expu::darray<int>;
+
+    constexpr int producer_count = 4;
+    constexpr int consumer_count = 4;
+    constexpr int buffers_per_producer = 2000;
+
+    expu::mpmc_queue<buffer_type> queue(64);
+
+    std::atomic<int64_t> total = 0;
+    std::atomic<int>     received = 0;
+
+    std::vector<std::thread> threads;
+
+    for (int p = 0; p < producer_count; ++p)
+        threads.emplace_back([&, p] {
+            for (int i = 0; i < buffers_per_producer; ++i) {
+                buffer_type buffer;
+                for (int j = 0; j <= i % 8; ++j)
+                    buffer.push_back(p * buffers_per_producer + i);
+
+                while (!queue.try_push(std::move(buffer)))
+                    std::this_thread::yield();
+            }
+        });
+
+    for (int c = 0; c < consumer_count; ++c)
+        threads.emplace_back([&] {
+            buffer_type buffers[8];
+
+            while (received.load() != producer_count * buffers_per_producer) {
+                const auto count = static_cast<int>(queue.try_pop_n(buffers, 8));
+
+                for (int i = 0; i < count; ++i) {
+                    int64_t sum = 0;
+                    for (const int value : buffers[i])
+                        sum += value;
+
+                    //Each buffer holds copies of a single value, as many as its index modulo 8 plus one
+                    EXPECT_EQ(sum, int64_t(buffers[i].size()) * buffers[i].begin()[0]);
+                    total += buffers[i].begin()[0];
+                }
+
+                if (count == 0)
+                    std::this_thread::yield();
+
+                received += count;
+            }
+        });
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    const int64_t values = producer_count * buffers_per_producer;
+    EXPECT_EQ(total.load(), values * (values - 1) / 2);
+    EXPECT_EQ(queue.size_approx(), 0);
+}
@@ -0,0 +1,110 @@
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <cstring>
+
+#include "expu/allocators/numa_allocator.hpp"
+#include "expu/containers/darray.hpp"
+#include "expu/containers/fixed_array.hpp"
+#include "expu/iterators/seq_iter.hpp"
+
+
+#ifdef EXPU_HAS_MBIND
+//Returns the memory policy of the page containing ptr
+static int _policy_of(void* const ptr)
+{
+    constexpr int mpol_f_addr = 1 << 1;
+
+    int mode = -1;
+    unsigned long mask = 0;
+    syscall(SYS_get_mempolicy, &mode, &mask, expu::_numa_max_nodes, ptr, mpol_f_addr);
+
+    return mode;
+}
+
+//Whether mbind is permitted, as seccomp profiles of containers often refuse it without CAP_SYS_NICE
+static bool _can_mbind()
+{
+    static const bool permitted = [] {
+        const size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+        void* const ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED)
+            return false;
+
+        unsigned long node_mask = expu::_numa_allowed_nodes() ? expu::_numa_allowed_nodes() : 1ul;
+        const bool result = syscall(SYS_mbind, ptr, size, expu::_mpol_bind, &node_mask, expu::_numa_max_nodes + 1, 0u) == 0;
+
+        munmap(ptr, size);
+        return result;
+    }();
+
+    return permitted;
+}
+
+TEST(numa_allocator_tests, mapped_allocations_follow_policy)
+{
+    //Note: Policies are best effort, hence are only observable where mbind is permitted
+    if (!_can_mbind())
+        GTEST_SKIP() << "mbind is not permitted";
+
+    //Note: Every machine has node 0, and unknown nodes in the mask are ignored
+    constexpr size_t test_size = size_t(1) << 22;
+
+    for (const auto& [policy, mode] : { std::pair(expu::numa_policy::bind, expu::_mpol_bind), std::pair(expu::numa_policy::interleave, expu::_mpol_interleave) }) {
+        expu::numa_allocator<char> alloc(policy, ~0ul);
+
+        char* const ptr = alloc.allocate(test_size);
+        std::memset(ptr, 1, test_size);
+
+        EXPECT_EQ(_policy_of(ptr), mode);
+        alloc.deallocate(ptr, test_size);
+    }
+
+    //The default is left to first touch
+    expu::numa_allocator<char> alloc;
+
+    char* const ptr = alloc.allocate(test_size);
+    EXPECT_EQ(_policy_of(ptr), 0);
+    alloc.deallocate(ptr, test_size);
+}
+#endif // EXPU_HAS_MBIND
+
+TEST(numa_allocator_tests, policy_is_rebound_and_propagated)
+{
+    using alloc_type = expu::numa_allocator<uint64_t>;
+    using array_type = expu::darray<uint64_t, alloc_type>;
+
+    const expu::numa_allocator<char> bound(expu::numa_policy::bind, 1);
+
+    const alloc_type rebound(bound);
+    EXPECT_EQ(rebound.policy(),    expu::numa_policy::bind);
+    EXPECT_EQ(rebound.node_mask(), 1);
+
+    array_type arr(rebound);
+    arr.push_back(1);
+
+    array_type other;
+
+    other = arr;
+    EXPECT_EQ(other.get_allocator().policy(), expu::numa_policy::bind);
+    EXPECT_EQ(other.size(), 1);
+}
+
+TEST(numa_allocator_tests, darray_and_fixed_array)
+{
+    using alloc_type = expu::numa_allocator<uint64_t, size_t(1) << 16, true>;
+
+    constexpr uint64_t test_size = uint64_t(1) << 20;
+
+    const alloc_type alloc(expu::numa_policy::interleave, ~0ul);
+
+    expu::darray<uint64_t, alloc_type> arr(alloc);
+    for (uint64_t i = 0; i < test_size; ++i)
+        arr.push_back(i);
+
+    ASSERT_TRUE(std::equal(arr.begin(), arr.end(), expu::seq_iter<uint64_t>(0)));
+
+    const expu::fixed_array<uint64_t, alloc_type> fixed(test_size, 3, alloc);
+    EXPECT_TRUE(std::all_of(fixed.begin(), fixed.end(), [](uint64_t value) { return value == 3; }));
+}
@@ -0,0 +1,248 @@
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "expu/allocators/pool_allocator.hpp"
+#include "expu/containers/darray.hpp"
+#include "expu/containers/linear_map.hpp"
+
+
+TEST(pool_tests, allocations_are_aligned_and_disjoint)
+{
+    expu::pool pool(1024, 4096);
+
+    std::vector<std::pair<uintptr_t, size_t>> allocations;
+
+    //Note: Includes sizes beyond max_pooled_bytes, and alignments beyond max_align_t, which bypass the pool
+    for (size_t i = 0; i < 1000; ++i) {
+        const size_t bytes     = 1 + (i * 37) % 1500;
+        const size_t alignment = size_t(1) << (i % 7);
+
+        const auto address = reinterpret_cast<uintptr_t>(pool.allocate(bytes, alignment));
+        ASSERT_EQ(address % alignment, 0) << "Allocation: " << i;
+
+        //Fill so that any overlap is caught by the sanitizers, or the check below
+        std::memset(reinterpret_cast<void*>(address), static_cast<int>(i), bytes);
+        allocations.emplace_back(address, bytes);
+    }
+
+    std::vector<std::pair<uintptr_t, size_t>> sorted(allocations);
+    std::sort(sorted.begin(), sorted.end());
+    for (size_t i = 1; i < sorted.size(); ++i)
+        ASSERT_LE(sorted[i - 1].first + sorted[i - 1].second, sorted[i].first);
+
+    for (size_t i = 0; i < allocations.size(); ++i)
+        pool.deallocate(reinterpret_cast<void*>(allocations[i].first), allocations[i].second, size_t(1) << (i % 7));
+}
+
+TEST(pool_tests, blocks_are_reused_per_size_class)
+{
+    expu::pool pool;
+
+    void* const small  = pool.allocate(24);
+    void* const medium = pool.allocate(100);
+
+    pool.deallocate(small, 24);
+    pool.deallocate(medium, 100);
+
+    //Sizes rounding up to the same power of two share a free list
+    EXPECT_EQ(pool.allocate(100), medium);
+    EXPECT_EQ(pool.allocate(32),  small);
+
+    //Freed blocks are handed out last in, first out
+    void* const first  = pool.allocate(8);
+    void* const second = pool.allocate(8);
+
+    pool.deallocate(first,  8);
+    pool.deallocate(second, 8);
+
+    EXPECT_EQ(pool.allocate(8), second);
+    EXPECT_EQ(pool.allocate(8), first);
+}
+
+TEST(pool_tests, slabs_and_release)
+{
+    expu::pool pool(256, 4096);
+
+    for (int i = 0; i < 1000; ++i)
+        (void)pool.allocate(64);
+
+    //Slabs only grow the capacity for pooled sizes
+    const size_t capacity = pool.capacity();
+    EXPECT_GE(capacity, 1000 * 64);
+
+    void* const large = pool.allocate(1024);
+    EXPECT_EQ(pool.capacity(), capacity);
+    pool.deallocate(large, 1024);
+
+    pool.release();
+    EXPECT_EQ(pool.capacity(), 0);
+
+    //Still usable once released
+    EXPECT_NE(pool.allocate(64), nullptr);
+}
+
+TEST(pool_tests, try_expand)
+{
+    expu::pool pool(256);
+
+    void* const ptr = pool.allocate(40);
+
+    //Allocations expand freely within their block
+    EXPECT_TRUE(pool.try_expand(ptr,  40, 64));
+    EXPECT_TRUE(pool.try_expand(ptr,  64, 33));
+    EXPECT_FALSE(pool.try_expand(ptr, 64, 65));
+    EXPECT_FALSE(pool.try_expand(ptr, 256, 257));
+
+    //Over-aligned allocations bypass the pool, hence never expand
+    void* const over_aligned = pool.allocate(32, 32);
+    EXPECT_FALSE(pool.try_expand(over_aligned, 32, 64, 32));
+    pool.deallocate(over_aligned, 32, 32);
+
+    //Including through darray, which would otherwise write past the end of its buffer
+    struct alignas(32) over_aligned_type { char bytes[32]; };
+
+    expu::darray<over_aligned_type, expu::pool_allocator<over_aligned_type>> arr{ expu::pool_allocator<over_aligned_type>(pool) };
+    for (int i = 0; i < 4; ++i)
+        arr.push_back(over_aligned_type{ { static_cast<char>(i) } });
+
+    for (int i = 0; i < 4; ++i)
+        EXPECT_EQ(arr[i].bytes[0], i);
+}
+
+TEST(pool_tests, thread_local_pool)
+{
+    expu::pool* const main_pool = &expu::thread_local_pool();
+    EXPECT_EQ(&expu::thread_local_pool(), main_pool);
+
+    expu::pool* other_pool = nullptr;
+    std::thread([&] { other_pool = &expu::thread_local_pool(); }).join();
+
+    EXPECT_NE(other_pool, main_pool);
+}
+
+TEST(pool_allocator_tests, equality_and_rebind)
+{
+    expu::pool first_pool, second_pool;
+
+    const expu::pool_allocator<int> first(first_pool), second(second_pool);
+    const expu::pool_allocator<double> rebound(first);
+
+    EXPECT_TRUE(first == rebound);
+    EXPECT_FALSE(first == second);
+    EXPECT_EQ(&rebound.resource(), &first_pool);
+
+    //The pool is always explicit, there is no implicit per-thread default
+    static_assert(!std::is_default_constructible_v<expu::pool_allocator<int>>);
+
+    const expu::pool_allocator<int> thread_local_first(expu::thread_local_pool());
+    EXPECT_TRUE(thread_local_first == expu::pool_allocator<char>(expu::thread_local_pool()));
+    EXPECT_EQ(&thread_local_first.resource(), &expu::thread_local_pool());
+}
+
+TEST(pool_allocator_tests, darray)
+{
+    expu::pool pool;
+
+    using array_type = expu::darray<std::string, expu::pool_allocator<std::string>>;
+
+    array_type arr{ expu::pool_allocator<std::string>(pool) };
+    for (int i = 0; i < 100; ++i)
+        arr.emplace_back(std::to_string(i));
+
+    array_type copy(arr);
+    EXPECT_TRUE(copy.get_allocator() == arr.get_allocator());
+
+    ASSERT_EQ(copy.size(), 100);
+    for (int i = 0; i < 100; ++i)
+        ASSERT_EQ(copy.begin()[i], std::to_string(i));
+
+    //Grows within its 64 byte block whilst the size class allows
+    expu::darray<int, expu::pool_allocator<int>> ints{ expu::pool_allocator<int>(pool) };
+    ints.reserve(9);
+
+    const int* const first = std::to_address(ints.begin());
+    for (int i = 0; i < 10; ++i)
+        ints.push_back(i);
+
+    EXPECT_GT(ints.capacity(), 9);
+    EXPECT_EQ(std::to_address(ints.begin()), first);
+}
+
+TEST(pool_allocator_tests, darray_propagation)
+{
+    expu::pool first_pool, second_pool;
+
+    using array_type = expu::darray<std::string, expu::pool_allocator<std::string>>;
+
+    array_type source{ expu::pool_allocator<std::string>(first_pool) };
+    for (const char* value : { "a", "b", "c" })
+        source.emplace_back(value);
+
+    const auto equals_source = [&](const array_type& arr) {
+        return std::equal(arr.begin(), arr.end(), source.begin(), source.end());
+    };
+
+    //Copy assignment keeps the target's pool
+    array_type copy{ expu::pool_allocator<std::string>(second_pool) };
+    copy = source;
+
+    EXPECT_EQ(&copy.get_allocator().resource(), &second_pool);
+    EXPECT_TRUE(equals_source(copy));
+
+    //Move assignment and swap carry the pool along with the elements
+    array_type moved{ expu::pool_allocator<std::string>(second_pool) };
+    moved = array_type(source);
+
+    EXPECT_EQ(&moved.get_allocator().resource(), &first_pool);
+    EXPECT_TRUE(equals_source(moved));
+
+    std::swap(copy, moved);
+
+    EXPECT_EQ(&copy.get_allocator().resource(),  &first_pool);
+    EXPECT_EQ(&moved.get_allocator().resource(), &second_pool);
+}
+
+TEST(pool_allocator_tests, linear_map)
+{
+    using value_type = std::pair<int, std::string>;
+    using map_type   = expu::linear_map<int, std::string, expu::darray<value_type, expu::pool_allocator<value_type>>>;
+
+    expu::pool pool;
+
+    //Many small maps, repeatedly rebuilt, are served from the pool's free lists
+    std::vector<map_type> maps;
+    for (int round = 0; round < 3; ++round) {
+        maps.clear();
+
+        for (int i = 0; i < 100; ++i) {
+            map_type& map = maps.emplace_back(expu::pool_allocator<value_type>(pool));
+
+            for (int j = 0; j < i % 8; ++j)
+                map[j] = std::to_string(i * j);
+        }
+
+        if (round == 0)
+            continue;
+
+        for (int i = 0; i < 100; ++i) {
+            ASSERT_EQ(maps[i].size(), i % 8);
+            for (int j = 0; j < i % 8; ++j)
+                ASSERT_EQ(maps[i].at(j), std::to_string(i * j));
+        }
+    }
+
+    const size_t capacity = pool.capacity();
+
+    maps.clear();
+    for (int i = 0; i < 100; ++i)
+        maps.emplace_back(expu::pool_allocator<value_type>(pool))[i] = "value";
+
+    EXPECT_EQ(pool.capacity(), capacity);
+}
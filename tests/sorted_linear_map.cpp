@@ -0,0 +1,129 @@
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "expu/containers/sorted_linear_map.hpp"
+#include "expu/containers/split_darray.hpp"
+
+template<class Map, class Reference>
+static testing::AssertionResult is_equal(const Map& map, const Reference& reference)
+{
+    if (map.size() != reference.size())
+        return testing::AssertionFailure() << "size: " << map.size() << ", expected: " << reference.size();
+
+    //Iteration must be in key order
+    auto ref_it = reference.begin();
+    for (auto it = map.begin(); it != map.end(); ++it, ++ref_it)
+        if (!((*it).first == ref_it->first) || !((*it).second == ref_it->second))
+            return testing::AssertionFailure() << "unexpected element";
+
+    return testing::AssertionSuccess();
+}
+
+template<class Map>
+class sorted_linear_map_tests : public testing::Test {};
+
+using sorted_map_types = testing::Types<
+    expu::sorted_linear_map<int, int>,
+    expu::sorted_linear_map<int, int, expu::split_darray<int, int>>,
+    expu::sorted_linear_map<int, int, std::vector<std::pair<int, int>>, std::greater<int>>>;
+TYPED_TEST_SUITE(sorted_linear_map_tests, sorted_map_types);
+
+TYPED_TEST(sorted_linear_map_tests, find)
+{
+    using comp_type = typename TypeParam::key_compare;
+
+    for (int size : { 0, 1, 2, 3, 7, 8, 9, 100 }) {
+        TypeParam map;
+        std::map<int, int, comp_type> reference;
+
+        for (int i = 0; i < size; ++i) {
+            const int key = (i * 37) % 101 * 2;
+
+            map[key] = i;
+            reference[key] = i;
+        }
+
+        ASSERT_TRUE(is_equal(map, reference));
+
+        //Note: Odd keys are never present, and lie between every present key
+        for (int key = -1; key <= 203; ++key) {
+            const auto loc = map.find(key);
+
+            if (reference.contains(key)) {
+                ASSERT_NE(loc, map.end());
+                ASSERT_EQ((*loc).second, reference.at(key));
+            }
+            else
+                ASSERT_EQ(loc, map.end());
+        }
+    }
+}
+
+TYPED_TEST(sorted_linear_map_tests, insert_range)
+{
+    using comp_type = typename TypeParam::key_compare;
+
+    TypeParam map;
+    std::map<int, int, comp_type> reference;
+
+    for (int i = 0; i < 50; i += 2) {
+        map[i] = -i;
+        reference[i] = -i;
+    }
+
+    //Contains keys already present and repeated keys, of which only the first must be inserted
+    std::vector<std::pair<int, int>> additions;
+    for (int i = 0; i < 200; ++i)
+        additions.emplace_back((i * 13) % 97, i);
+
+    map.insert_range(additions);
+    reference.insert(additions.begin(), additions.end());
+
+    ASSERT_TRUE(is_equal(map, reference));
+
+    map.insert_range(std::vector<std::pair<int, int>>());
+    ASSERT_TRUE(is_equal(map, reference));
+}
+
+TYPED_TEST(sorted_linear_map_tests, erase)
+{
+    TypeParam map;
+    for (int i = 0; i < 30; ++i)
+        map[i] = i;
+
+    for (int i = 0; i < 30; i += 4)
+        map.erase(i);
+
+    map.erase(100);
+
+    for (int i = 0; i < 30; ++i) {
+        if (i % 4 == 0)
+            ASSERT_THROW((void)map.at(i), std::out_of_range);
+        else
+            ASSERT_EQ(map.at(i), i);
+    }
+}
+
+TEST(sorted_linear_map_tests, range_construction)
+{
+    const std::vector<std::pair<std::string, int>> values = {
+        { "delta", 4 }, { "alpha", 1 }, { "charlie", 3 }, { "bravo", 2 }, { "alpha", 5 } };
+
+    const expu::sorted_linear_map<std::string, int> map(values);
+
+    ASSERT_EQ(map.size(), 4);
+    ASSERT_EQ(map.begin()->first, "alpha");
+    ASSERT_EQ(map.at("alpha"), 1);
+    ASSERT_EQ(map.at("delta"), 4);
+
+    expu::sorted_linear_map<std::string, int> copy(map);
+    ASSERT_EQ(copy, map);
+
+    copy["echo"] = 5;
+    ASSERT_FALSE(copy == map);
+    ASSERT_EQ(std::prev(copy.end())->first, "echo");
+}
@@ -0,0 +1,140 @@
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "expu/containers/spsc_ring.hpp"
+
+
+TEST(spsc_ring_tests, capacity_is_rounded_up)
+{
+    EXPECT_EQ(expu::spsc_ring<char>(0).capacity(),    1);
+    EXPECT_EQ(expu::spsc_ring<char>(5).capacity(),    8);
+    EXPECT_EQ(expu::spsc_ring<char>(4096).capacity(), 4096);
+
+    //Producer and consumer indices must not share a cache line
+    EXPECT_GE(sizeof(expu::spsc_ring<char>), 3 * expu::_cache_line_size);
+}
+
+TEST(spsc_ring_tests, acquire_commit_and_release)
+{
+    expu::spsc_ring<int> ring(8);
+
+    EXPECT_TRUE(ring.acquire_read().empty());
+
+    //Write 6 elements in place, but only publish 5
+    std::span<int> write = ring.acquire_write(6);
+    ASSERT_EQ(write.size(), 6);
+    std::iota(write.begin(), write.end(), 0);
+
+    ring.commit_write(5);
+    EXPECT_EQ(ring.size_approx(), 5);
+
+    std::span<int> read = ring.acquire_read();
+    ASSERT_EQ(read.size(), 5);
+    EXPECT_EQ(read[4], 4);
+
+    ring.release_read(3);
+
+    //Free space is split by the end of the ring, hence only its contiguous part is acquired
+    write = ring.acquire_write();
+    EXPECT_EQ(write.size(), 3);
+    std::iota(write.begin(), write.end(), 5);
+    ring.commit_write(3);
+
+    write = ring.acquire_write();
+    EXPECT_EQ(write.size(), 3);
+    std::iota(write.begin(), write.end(), 8);
+    ring.commit_write(3);
+
+    EXPECT_TRUE(ring.acquire_write().empty());
+
+    //Likewise for reading, up to the end then from the start
+    read = ring.acquire_read();
+    ASSERT_EQ(read.size(), 5);
+    EXPECT_EQ(read[0], 3);
+    EXPECT_EQ(read[4], 7);
+    ring.release_read(5);
+
+    read = ring.acquire_read(2);
+    ASSERT_EQ(read.size(), 2);
+    EXPECT_EQ(read[0], 8);
+    ring.release_read(2);
+
+    read = ring.acquire_read();
+    ASSERT_EQ(read.size(), 1);
+    EXPECT_EQ(read[0], 10);
+    ring.release_read(1);
+
+    EXPECT_EQ(ring.size_approx(), 0);
+}
+
+TEST(spsc_ring_tests, bulk_write_and_read_wrap_around)
+{
+    expu::spsc_ring<uint32_t> ring(16);
+
+    std::vector<uint32_t> source(100);
+    std::iota(source.begin(), source.end(), 0);
+
+    std::vector<uint32_t> result(100);
+
+    size_t written = 0, read = 0;
+
+    //Odd sized chunks, so that copies straddle the end of the ring
+    while (read != source.size()) {
+        written += ring.try_write(source.data() + written, std::min<size_t>(7, source.size() - written));
+        read    += ring.try_read(result.data() + read, 5);
+    }
+
+    EXPECT_EQ(ring.try_write(source.data(), 20), 16);
+    EXPECT_EQ(ring.try_write(source.data(), 1),  0);
+
+    EXPECT_EQ(result, source);
+}
+
+TEST(spsc_ring_tests, hands_off_bytes_between_threads)
+{
+    constexpr size_t total_bytes = size_t(1) << 22;
+
+    expu::spsc_ring<uint8_t> ring(4096);
+
+    std::thread producer([&] {
+        size_t written = 0;
+
+        //Decode directly in to the ring
+        while (written != total_bytes) {
+            const std::span<uint8_t> span = ring.acquire_write(total_bytes - written);
+
+            for (size_t i = 0; i < span.size(); ++i)
+                span[i] = static_cast<uint8_t>((written + i) * 31);
+
+            ring.commit_write(span.size());
+            written += span.size();
+
+            if (span.empty())
+                std::this_thread::yield();
+        }
+    });
+
+    size_t read = 0, mismatches = 0;
+    while (read != total_bytes) {
+        const std::span<uint8_t> span = ring.acquire_read();
+
+        for (size_t i = 0; i < span.size(); ++i)
+            mismatches += span[i] != static_cast<uint8_t>((read + i) * 31);
+
+        ring.release_read(span.size());
+        read += span.size();
+
+        if (span.empty())
+            std::this_thread::yield();
+    }
+
+    producer.join();
+
+    EXPECT_EQ(mismatches, 0);
+    EXPECT_EQ(ring.size_approx(), 0);
+}
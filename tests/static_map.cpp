@@ -0,0 +1,97 @@
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "expu/containers/static_map.hpp"
+
+using namespace std::string_view_literals;
+
+enum class opcode : uint8_t { nop, load, store, add, sub, jump, halt };
+
+constexpr auto opcode_names = expu::make_static_map<opcode, std::string_view>({
+    { opcode::nop,   "nop"   },
+    { opcode::load,  "load"  },
+    { opcode::store, "store" },
+    { opcode::add,   "add"   },
+    { opcode::sub,   "sub"   },
+    { opcode::jump,  "jump"  },
+    { opcode::halt,  "halt"  } });
+
+constexpr auto opcode_values = expu::make_static_map<std::string_view, opcode>({
+    { "nop",   opcode::nop   },
+    { "load",  opcode::load  },
+    { "store", opcode::store },
+    { "add",   opcode::add   },
+    { "sub",   opcode::sub   },
+    { "jump",  opcode::jump  },
+    { "halt",  opcode::halt  } });
+
+//Built at compile time, hence lookups are usable in constant expressions
+static_assert(opcode_names.at(opcode::store) == "store");
+static_assert(opcode_values.at("jump") == opcode::jump);
+static_assert(!opcode_values.contains("call"));
+static_assert(opcode_names.size() == 7);
+
+TEST(static_map_tests, enum_and_string_keys)
+{
+    for (uint8_t value = 0; value <= static_cast<uint8_t>(opcode::halt); ++value) {
+        const auto code = static_cast<opcode>(value);
+        const auto name = opcode_names.at(code);
+
+        ASSERT_EQ(opcode_values.at(name), code);
+    }
+
+    //Transparent lookups, without constructing a std::string_view key
+    ASSERT_EQ(opcode_values.at(std::string("add")), opcode::add);
+    ASSERT_EQ(opcode_values.find("sub")->second, opcode::sub);
+
+    ASSERT_EQ(opcode_values.find("mul"), opcode_values.end());
+    ASSERT_FALSE(opcode_names.contains(static_cast<opcode>(100)));
+    ASSERT_THROW((void)opcode_values.at(""), std::out_of_range);
+}
+
+TEST(static_map_tests, iteration)
+{
+    size_t count = 0;
+    for (const auto& [key, value] : opcode_values) {
+        ASSERT_EQ(opcode_names.at(value), key);
+        ++count;
+    }
+
+    ASSERT_EQ(count, opcode_values.size());
+}
+
+TEST(static_map_tests, many_integral_keys)
+{
+    //Note: Built at runtime, as constant evaluation of this many keys may exceed compiler limits
+    static std::pair<int64_t, int> values[1000];
+
+    for (int i = 0; i < 1000; ++i)
+        values[i] = { (int64_t(i) * 7919 - 500) << 20, i };
+
+    const expu::static_map map(values);
+
+    for (const auto& [key, value] : values)
+        ASSERT_EQ(map.at(key), value);
+
+    for (int i = 0; i < 1000; ++i)
+        ASSERT_FALSE(map.contains(((int64_t(i) * 7919 - 500) << 20) + 1));
+}
+
+TEST(static_map_tests, single_element)
+{
+    constexpr auto map = expu::make_static_map<int, int>({ { 5, 25 } });
+
+    static_assert(map.at(5) == 25);
+    ASSERT_FALSE(map.contains(4));
+}
+
+TEST(static_map_tests, repeated_keys)
+{
+    const std::pair<int, int> values[] = { { 1, 1 }, { 2, 2 }, { 1, 3 } };
+
+    ASSERT_THROW(expu::static_map map(values), std::invalid_argument);
+}